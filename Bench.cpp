@@ -0,0 +1,794 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+
+// benchmarks, run with : Pictor --bench
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <fstream>
+#include <cstdio>
+#include "Model.h"
+#include "ObjGeom.h"
+#include "SceneFile.h"
+#include "SoftGraphics.h"
+#include "GeomKernels.h"
+#include "CircleTable.h"
+#include "EventQueue.h"
+#include "StrokeFont.h"
+
+using namespace std;
+
+typedef chrono::high_resolution_clock Clock;
+
+static double elapsedUs(Clock::time_point t0)
+{
+	return chrono::duration<double, micro>(Clock::now() - t0).count();
+}
+
+// random mix of rectangles, segments, circles and polylines
+// the drawing area grows with the number of objects to keep a constant density
+static void fillScene(Model& M, int nbObjects, V2& area, mt19937& rng)
+{
+	M.clearObjects();
+
+	int side = (int)sqrt((double)nbObjects * 40 * 40);
+	area = V2(side, side);
+
+	uniform_int_distribution<int> pos(0, side), len(5, 60), type(0, 3);
+	ObjAttr A(Color::Cyan, true, Color::Yellow, 2);
+
+	for (int i = 0; i < nbObjects; ++i)
+	{
+		V2 P1(pos(rng), pos(rng));
+		V2 P2 = P1 + V2(len(rng), len(rng));
+
+		switch (type(rng))
+		{
+		case 0: M.addObject(makeObject<ObjRectangle>(A, P1, P2)); break;
+		case 1: M.addObject(makeObject<ObjSegment>(A, P1, P2)); break;
+		case 2: M.addObject(makeObject<ObjCircle>(A, P1, P1 + V2(len(rng) / 3, 0))); break;
+		default:
+		{
+			vector<V2> pts = { P1, P1 + V2(len(rng), 0), P2, P2 + V2(0, len(rng)) };
+			M.addObject(makeObject<ObjPolyLine>(A, pts));
+		}
+		}
+	}
+}
+
+// previous ToolSelect implementation : scan all the objects from the top
+static shared_ptr<ObjGeom> linearPick(const Model& M, const V2& p)
+{
+	for (auto it = M.LObjets.rbegin(); it != M.LObjets.rend(); ++it)
+		if ((*it)->contains(p)) return *it;
+	return nullptr;
+}
+
+void runPickBenchmark()
+{
+	cout << "Pick latency (ToolSelect) vs object count" << endl;
+	cout << setw(10) << "objects" << setw(16) << "linear us/pick" << setw(16) << "index us/pick" << setw(10) << "speedup" << endl;
+
+	Model M;
+	mt19937 rng(1234);
+	const int nbPicks = 2000;
+
+	for (int n : { 1000, 10000, 50000, 100000, 200000 })
+	{
+		V2 area;
+		fillScene(M, n, area, rng);
+
+		uniform_int_distribution<int> px(0, area.x), py(0, area.y);
+		vector<V2> clicks;
+		for (int i = 0; i < nbPicks; ++i) clicks.push_back(V2(px(rng), py(rng)));
+
+		// the linear scan is slow : fewer samples on big scenes
+		int nbLinear = max(50, nbPicks * 1000 / n);
+		int mismatch = 0;
+
+		auto t0 = Clock::now();
+		for (int i = 0; i < nbLinear; ++i)
+			if (linearPick(M, clicks[i]) != M.pick(clicks[i])) mismatch++;
+		double tLinear = elapsedUs(t0);
+
+		// remove the cost of the indexed picks done in the check loop
+		t0 = Clock::now();
+		for (int i = 0; i < nbLinear; ++i) M.pick(clicks[i]);
+		tLinear -= elapsedUs(t0);
+
+		t0 = Clock::now();
+		for (const V2& c : clicks) M.pick(c);
+		double tIndex = elapsedUs(t0);
+
+		double usLinear = tLinear / nbLinear;
+		double usIndex  = tIndex / nbPicks;
+		cout << setw(10) << n << setw(16) << fixed << setprecision(3) << usLinear
+			<< setw(16) << usIndex << setw(9) << setprecision(1) << usLinear / usIndex << "x";
+		if (mismatch) cout << "  (" << mismatch << " different results !)";
+		cout << endl;
+	}
+}
+
+// previous ToolEditPoints implementation : ask every object from the top
+static V2* linearGrab(const Model& M, const V2& p, int radius)
+{
+	for (auto it = M.LObjets.rbegin(); it != M.LObjets.rend(); ++it)
+		if (V2* q = (*it)->findClosestControlPoint(p, (float)radius)) return q;
+	return nullptr;
+}
+
+void runControlPointBenchmark()
+{
+	cout << endl << "Grab a control point (ToolEditPoints) vs vertex count, polylines of 50 points" << endl;
+	cout << setw(10) << "vertices" << setw(16) << "linear us/grab" << setw(16) << "index us/grab" << setw(14) << "us/drag" << endl;
+
+	Model M;
+	mt19937 rng(1234);
+	const int radius = 10, nbGrabs = 2000, nbDrags = 2000;
+
+	for (int nbVertices : { 100000, 1000000, 5000000 })
+	{
+		// random walks, same density as fillScene
+		int nbLines = nbVertices / 50;
+		int side = (int)sqrt((double)nbLines * 40 * 40);
+		uniform_int_distribution<int> pos(0, side), step(-8, 8);
+		ObjAttr A(Color::Cyan, false, Color::Yellow, 2);
+
+		M.clearObjects();
+		for (int i = 0; i < nbLines; ++i)
+		{
+			vector<V2> pts(50);
+			pts[0] = V2(pos(rng), pos(rng));
+			for (size_t k = 1; k < pts.size(); ++k) pts[k] = pts[k - 1] + V2(step(rng), step(rng));
+			M.addObject(makeObject<ObjPolyLine>(A, pts));
+		}
+
+		uniform_int_distribution<int> px(0, side);
+		vector<V2> clicks;
+		for (int i = 0; i < nbGrabs; ++i) clicks.push_back(V2(px(rng), px(rng)));
+
+		int nbLinear = max(20, nbGrabs * 10000 / nbVertices);
+		int mismatch = 0;
+
+		auto t0 = Clock::now();
+		vector<V2*> expected;
+		for (int i = 0; i < nbLinear; ++i) expected.push_back(linearGrab(M, clicks[i], radius));
+		double tLinear = elapsedUs(t0) / nbLinear;
+
+		size_t index;
+		t0 = Clock::now();
+		for (const V2& c : clicks) M.pickControlPoint(c, radius, index);
+		double tIndex = elapsedUs(t0) / nbGrabs;
+
+		for (int i = 0; i < nbLinear; ++i)
+		{
+			auto obj = M.pickControlPoint(clicks[i], radius, index);
+			if ((obj ? obj->getControlPoint(index) : nullptr) != expected[i]) mismatch++;
+		}
+
+		// drag of a grabbed point, as in ToolEditPoints
+		shared_ptr<ObjGeom> obj;
+		for (size_t i = 0; !obj; ++i) obj = M.pickControlPoint(clicks[i % nbGrabs], radius, index);
+		t0 = Clock::now();
+		for (int i = 0; i < nbDrags; ++i)
+		{
+			M.moveControlPoint(obj.get(), index, *obj->getControlPoint(index) + V2(step(rng), step(rng)));
+		}
+		double tDrag = elapsedUs(t0) / nbDrags;
+
+		cout << setw(10) << nbVertices << setw(16) << fixed << setprecision(2) << tLinear
+			<< setw(16) << tIndex << setw(14) << tDrag;
+		if (mismatch) cout << "  (" << mismatch << " different results !)";
+		cout << endl;
+	}
+}
+
+void runPolyLineBenchmark()
+{
+	cout << endl << "Hit test of one long polyline (GPS track) vs vertex count" << endl;
+	cout << setw(10) << "vertices" << setw(16) << "linear us/hit" << setw(16) << "boxes us/hit" << setw(14) << "us/drag" << endl;
+
+	mt19937 rng(1234);
+	const int nbHits = 2000, nbDrags = 200;
+	uniform_int_distribution<int> step(-6, 6), near(-8, 8);
+
+	for (int n : { 1000, 10000, 100000, 1000000 })
+	{
+		Model M;
+		vector<V2> pts(n);
+		for (int k = 1; k < n; ++k) pts[k] = pts[k - 1] + V2(step(rng) + 1, step(rng));
+		auto line = makeObject<ObjPolyLine>(ObjAttr(Color::Cyan, false, Color::Yellow, 2), pts);
+		M.addObject(line);
+
+		// half around the track, half anywhere in its box
+		V2 P, size;
+		line->getBoundingBox(P, size);
+		uniform_int_distribution<int> vertex(0, n - 1), px(P.x, P.x + size.x), py(P.y, P.y + size.y);
+		vector<V2> clicks;
+		for (int i = 0; i < nbHits; ++i)
+			clicks.push_back((i & 1) ? V2(px(rng), py(rng)) : pts[vertex(rng)] + V2(near(rng), near(rng)));
+
+		int nbLinear = max(20, nbHits * 1000 / n);
+		int mismatch = 0;
+
+		auto t0 = Clock::now();
+		vector<bool> expected;
+		for (int i = 0; i < nbLinear; ++i) expected.push_back(ObjPolyLine::hit(pts.data(), pts.size(), clicks[i]));
+		double tLinear = elapsedUs(t0) / nbLinear;
+
+		line->contains(clicks[0]);   // builds the boxes
+		t0 = Clock::now();
+		for (const V2& c : clicks) line->contains(c);
+		double tBoxes = elapsedUs(t0) / nbHits;
+
+		for (int i = 0; i < nbLinear; ++i)
+			if (line->contains(clicks[i]) != expected[i]) mismatch++;
+
+		// drag of a vertex, as in ToolEditPoints : boxes updated in place, then a hit test
+		t0 = Clock::now();
+		for (int i = 0; i < nbDrags; ++i)
+		{
+			size_t k = vertex(rng);
+			M.moveControlPoint(line.get(), k, *line->getControlPoint(k) + V2(step(rng), step(rng)));
+			if (M.pick(clicks[i]) != line && line->contains(clicks[i])) mismatch++;
+		}
+		double tDrag = elapsedUs(t0) / nbDrags;
+
+		for (int i = 0; i < nbLinear; ++i)
+			if (line->contains(clicks[i]) != ObjPolyLine::hit(line->getPoints().data(), n, clicks[i])) mismatch++;
+
+		cout << setw(10) << n << setw(16) << fixed << setprecision(2) << tLinear
+			<< setw(16) << tBoxes << setw(14) << tDrag;
+		if (mismatch) cout << "  (" << mismatch << " different results !)";
+		cout << endl;
+	}
+}
+
+// previous ObjPolyLine::contains and findClosestControlPoint, on V2::norm
+static size_t referenceSegmentHit(const V2* pts, size_t nbSegments, V2 P)
+{
+	for (size_t i = 0; i < nbSegments; ++i)
+	{
+		V2 A = pts[i], B = pts[i + 1];
+		if (fabs((P - A).norm() + (P - B).norm() - (B - A).norm()) < 4.0) return i;
+	}
+	return nbSegments;
+}
+
+void runKernelBenchmark()
+{
+	cout << endl << "Geometry kernels, 1M points, ns per point (selected : " << geomKernels().name << ")" << endl;
+	cout << setw(10) << "version" << setw(16) << "segment hit" << endl;
+
+	mt19937 rng(1234);
+	uniform_int_distribution<int> step(-6, 6), near(-6, 6);
+	const size_t n = 1000000;
+	const int nbQueries = 40;
+
+	vector<V2> pts(n);
+	for (size_t k = 1; k < n; ++k) pts[k] = pts[k - 1] + V2(step(rng) + 1, step(rng));
+
+	// close to random points of the track : the scans stop at various places
+	uniform_int_distribution<size_t> vertex(0, n - 1);
+	vector<V2> queries;
+	for (int i = 0; i < nbQueries; ++i) queries.push_back(pts[vertex(rng)] + V2(near(rng), near(rng)));
+	queries.push_back(V2(-1000, -1000));   // full scan
+
+	vector<size_t> hits;
+	auto t0 = Clock::now();
+	double points = 0;
+	for (const V2& q : queries) { hits.push_back(referenceSegmentHit(pts.data(), n - 1, q)); points += hits.back() + 1; }
+	double tHit = elapsedUs(t0) * 1000 / points;
+	cout << setw(10) << "previous" << setw(16) << fixed << setprecision(3) << tHit << endl;
+
+	for (int l = 0; l < (int)KernelLevel::Count; ++l)
+	{
+		const GeomKernels* K = geomKernels((KernelLevel)l);
+		if (!K) continue;
+		int mismatch = 0;
+
+		t0 = Clock::now();
+		for (size_t i = 0; i < queries.size(); ++i)
+			if (K->firstSegmentHit(pts.data(), n - 1, queries[i], 4.0) != hits[i]) mismatch++;
+		tHit = elapsedUs(t0) * 1000 / points;
+
+		cout << setw(10) << K->name << setw(16) << tHit;
+		if (mismatch) cout << "  (" << mismatch << " different results !)";
+		cout << endl;
+	}
+}
+
+void runIdBufferBenchmark()
+{
+	cout << endl << "ID buffer pick, 1600x800 view (ToolSelect, hover) vs object count" << endl;
+	cout << setw(10) << "objects" << setw(12) << "build ms" << setw(14) << "lookup ns" << setw(16) << "geometric ns" << setw(12) << "us/edit" << endl;
+
+	Model M;
+	mt19937 rng(1234);
+	const V2 view(1600, 800);
+	const int nbLookups = 100000, nbEdits = 1000;
+
+	for (int n : { 1000, 10000, 100000 })
+	{
+		V2 area;
+		fillScene(M, n, area, rng);   // same density : the objects past the view are not drawn
+		M.setViewSize(view);
+
+		auto t0 = Clock::now();
+		M.slotAt(V2(0, 0));
+		double tBuild = elapsedUs(t0) / 1000;
+
+		uniform_int_distribution<int> px(0, view.x - 1), py(0, view.y - 1);
+		vector<V2> clicks;
+		for (int i = 0; i < nbLookups; ++i) clicks.push_back(V2(px(rng), py(rng)));
+
+		size_t found = 0;
+		t0 = Clock::now();
+		for (const V2& c : clicks) found += (M.objectAt(c) != nullptr);
+		double tLookup = elapsedUs(t0) * 1000 / nbLookups;
+
+		t0 = Clock::now();
+		for (const V2& c : clicks) found += (M.pick(c) != nullptr);
+		double tGeometric = elapsedUs(t0) * 1000 / nbLookups;
+		if (found == 0) cout << "(empty view) ";
+
+		// move an object under a random point, then look up : the modified regions are drawn again
+		int edits = 0;
+		t0 = Clock::now();
+		for (int i = 0; edits < nbEdits && i < nbLookups; ++i)
+		{
+			shared_ptr<ObjGeom> obj = M.pickDrawn(clicks[i]);
+			if (!obj) continue;
+			M.moveControlPoint(obj.get(), 0, *obj->getControlPoint(0) + V2(3, 2));
+			M.slotAt(clicks[i]);
+			edits++;
+		}
+		double tEdit = elapsedUs(t0) / max(1, edits);
+
+		// the buffer refreshed by regions must be the one drawn from scratch
+		vector<uint32_t> incremental;
+		for (int y = 0; y < view.y; ++y)
+			for (int x = 0; x < view.x; ++x) incremental.push_back(M.slotAt(V2(x, y)));
+		M.setViewSize(V2(0, 0));
+		M.setViewSize(view);
+		int mismatch = 0;
+		for (int y = 0; y < view.y; ++y)
+			for (int x = 0; x < view.x; ++x)
+				if (M.slotAt(V2(x, y)) != incremental[(size_t)y * view.x + x]) mismatch++;
+
+		cout << setw(10) << n << setw(12) << fixed << setprecision(2) << tBuild << setw(14) << setprecision(1) << tLookup
+			<< setw(16) << tGeometric << setw(12) << setprecision(2) << tEdit;
+		if (mismatch) cout << "  (" << mismatch << " different pixels !)";
+		cout << endl;
+	}
+}
+
+void runRegionSelectBenchmark()
+{
+	cout << endl << "Rubber band selection 400x300 (ToolSelect) vs object count" << endl;
+	cout << setw(10) << "objects" << setw(14) << "scan us" << setw(14) << "index us" << setw(12) << "selected" << endl;
+
+	Model M;
+	mt19937 rng(1234);
+	const int nbQueries = 200;
+
+	for (int n : { 10000, 100000, 200000 })
+	{
+		V2 area;
+		fillScene(M, n, area, rng);
+		uniform_int_distribution<int> px(0, area.x - 400), py(0, area.y - 300);
+
+		int mismatch = 0;
+		size_t selected = 0;
+		double tScan = 0, tIndex = 0;
+		for (int i = 0; i < nbQueries; ++i)
+		{
+			V2 P(px(rng), py(rng)), size(400, 300);
+			bool contained = (i & 1) != 0;
+
+			auto t0 = Clock::now();
+			vector< shared_ptr<ObjGeom> > scan;
+			for (auto& obj : M.LObjets)
+			{
+				V2 B, Bsize;
+				obj->getBoundingBox(B, Bsize);
+				bool inside    = B.x >= P.x && B.y >= P.y && B.x + Bsize.x <= P.x + size.x && B.y + Bsize.y <= P.y + size.y;
+				bool intersect = B.x <= P.x + size.x && P.x <= B.x + Bsize.x && B.y <= P.y + size.y && P.y <= B.y + Bsize.y;
+				if (contained ? inside : intersect) scan.push_back(obj);
+			}
+			tScan += elapsedUs(t0);
+
+			t0 = Clock::now();
+			vector< shared_ptr<ObjGeom> > found;
+			M.objectsInRegion(P, size, contained, found);
+			tIndex += elapsedUs(t0);
+
+			if (found != scan) mismatch++;
+			selected += found.size();
+		}
+
+		cout << setw(10) << n << setw(14) << fixed << setprecision(1) << tScan / nbQueries << setw(14) << tIndex / nbQueries
+			<< setw(12) << selected / nbQueries;
+		if (mismatch) cout << "  (" << mismatch << " different results !)";
+		cout << endl;
+	}
+}
+
+// previous circle tessellation : a new vector, r/4 vertices (at least 20), cos and sin for each
+static void referenceCircle(const ObjAttr& A, const V2& C, int r, vector<GVertex>& fill, vector<GVertex>& lines)
+{
+	int n = max(20, r / 4);
+	double step = 2 * 3.14159265358 / n;
+
+	vector<V2> pts;
+	for (int i = 0; i <= n; i++)
+		pts.push_back(V2(C.x + r * cos(i * step), C.y + r * sin(i * step)));
+
+	for (size_t i = 0; i + 1 < pts.size(); ++i)
+	{
+		fill.push_back(GVertex(C, A.interiorColor_));
+		fill.push_back(GVertex(pts[i], A.interiorColor_));
+		fill.push_back(GVertex(pts[i + 1], A.interiorColor_));
+		lines.push_back(GVertex(pts[i], A.borderColor_));
+		lines.push_back(GVertex(pts[i + 1], A.borderColor_));
+	}
+}
+
+void runCircleBenchmark()
+{
+	cout << endl << "Circle tessellation, trigonometry per vertex vs tables" << endl;
+	cout << setw(10) << "radius" << setw(12) << "old sides" << setw(12) << "new sides" << setw(14) << "old ns/circle" << setw(14) << "new ns/circle" << endl;
+
+	ObjAttr A(Color::Cyan, true, Color::Yellow, 2);
+	vector<GVertex> fill, lines;
+	const int nbCircles = 20000;
+
+	for (int r : { 5, 20, 100, 400, 2000 })
+	{
+		V2 C(500, 500), P2 = C + V2(r, 0);
+
+		auto t0 = Clock::now();
+		for (int i = 0; i < nbCircles; ++i)
+		{
+			fill.clear();
+			lines.clear();
+			referenceCircle(A, C, r, fill, lines);
+		}
+		double tOld = elapsedUs(t0) * 1000 / nbCircles;
+
+		t0 = Clock::now();
+		for (int i = 0; i < nbCircles; ++i)
+		{
+			fill.clear();
+			lines.clear();
+			ObjCircle::tessellate(A, C, P2, fill, lines);
+		}
+		double tNew = elapsedUs(t0) * 1000 / nbCircles;
+
+		cout << setw(10) << r << setw(12) << max(20, r / 4) << setw(12) << circleSides((float)r)
+			<< setw(14) << fixed << setprecision(1) << tOld << setw(14) << tNew << endl;
+	}
+}
+
+void runZOrderBenchmark()
+{
+	cout << endl << "Bring to front / send to back / remove + insert back, vs object count" << endl;
+	cout << setw(10) << "objects" << setw(14) << "us/reorder" << setw(14) << "us/remove" << endl;
+
+	Model M;
+	mt19937 rng(1234);
+	const int nbOps = 5000;
+
+	for (int n : { 10000, 100000, 200000 })
+	{
+		V2 area;
+		fillScene(M, n, area, rng);
+		vector<shared_ptr<ObjGeom>> all = M.LObjets.toVector();
+		uniform_int_distribution<int> pick(0, n - 1);
+
+		auto t0 = Clock::now();
+		for (int i = 0; i < nbOps; ++i)
+		{
+			const ObjGeom* obj = all[pick(rng)].get();
+			if (i % 2) M.bringToFront(obj);
+			else       M.sendToBack(obj);
+		}
+		double tReorder = elapsedUs(t0) / nbOps;
+
+		t0 = Clock::now();
+		for (int i = 0; i < nbOps; ++i)
+		{
+			auto& obj = all[pick(rng)];
+			M.removeObject(obj.get());
+			M.insertObject(obj);
+		}
+		double tRemove = elapsedUs(t0) / nbOps;
+
+		cout << setw(10) << n << setw(14) << fixed << setprecision(2) << tReorder << setw(14) << tRemove << endl;
+	}
+}
+
+// text format, in eleve.cpp
+std::string sceneToString(const Model& Data);
+std::vector<std::shared_ptr<ObjGeom>> stringToObjects(const std::string& text);
+
+void runSceneFileBenchmark()
+{
+	cout << endl << "Scene file load time, text vs binary (.pbin)" << endl;
+	cout << setw(10) << "objects" << setw(14) << "text ms" << setw(14) << "binary ms" << setw(12) << "text KB" << setw(12) << "binary KB"
+		<< setw(16) << "pool chunks" << endl;
+
+	Model M;
+	mt19937 rng(1234);
+
+	for (int n : { 10000, 100000, 200000 })
+	{
+		V2 area;
+		fillScene(M, n, area, rng);
+
+		string text = sceneToString(M);
+		saveBinaryScene("bench_scene.pbin", M.store());
+		ifstream bin("bench_scene.pbin", ios::binary | ios::ate);
+		double binKB = bin.tellg() / 1024.0;
+
+		auto t0 = Clock::now();
+		auto fromText = stringToObjects(text);
+		double tText = elapsedUs(t0) / 1000;
+
+		// heap allocations of the object pools during the binary load
+		PoolStats before = PoolBase::totalStats();
+		vector<shared_ptr<ObjGeom>> fromBin;
+		t0 = Clock::now();
+		loadBinaryScene("bench_scene.pbin", fromBin);
+		double tBin = elapsedUs(t0) / 1000;
+		PoolStats after = PoolBase::totalStats();
+
+		cout << setw(10) << n << setw(14) << fixed << setprecision(1) << tText << setw(14) << tBin
+			<< setw(12) << text.size() / 1024.0 << setw(12) << binKB
+			<< setw(16) << after.heapAllocations - before.heapAllocations;
+		if (fromText.size() != fromBin.size()) cout << "  (different object counts !)";
+		cout << endl;
+	}
+	remove("bench_scene.pbin");
+}
+
+// counts the objects containing p, on the store rows
+struct HitCounter
+{
+	V2  p;
+	int hits = 0;
+
+	void operator()(const SceneStore::RectRef& o)     { hits += ObjRectangle::hit(o.P1, o.P2, p); }
+	void operator()(const SceneStore::SegmentRef& o)  { hits += ObjSegment::hit(o.P1, o.P2, o.attr.thickness_, p); }
+	void operator()(const SceneStore::CircleRef& o)   { hits += ObjCircle::hit(o.C, o.P2, p); }
+	void operator()(const SceneStore::PolyLineRef& o) { hits += ObjPolyLine::hit(o.pts, o.n, p); }
+};
+
+struct VertexCounter
+{
+	vector<GVertex> fill, lines;
+
+	void operator()(const SceneStore::RectRef& o)     { ObjRectangle::tessellate(o.attr, o.P1, o.P2, fill, lines); }
+	void operator()(const SceneStore::SegmentRef& o)  { ObjSegment::tessellate(o.attr, o.P1, o.P2, fill, lines); }
+	void operator()(const SceneStore::CircleRef& o)   { ObjCircle::tessellate(o.attr, o.C, o.P2, fill, lines); }
+	void operator()(const SceneStore::PolyLineRef& o) { ObjPolyLine::tessellate(o.attr, o.pts, o.n, fill, lines); }
+};
+
+void runDispatchBenchmark()
+{
+	cout << endl << "Virtual calls on the objects vs visitors on the store arrays, 200000 objects" << endl;
+	cout << setw(24) << "" << setw(14) << "virtual ms" << setw(14) << "visitor ms" << endl;
+
+	Model M;
+	mt19937 rng(1234);
+	V2 area;
+	fillScene(M, 200000, area, rng);
+
+	// full scan hit test : every object against a few points
+	uniform_int_distribution<int> px(0, area.x), py(0, area.y);
+	vector<V2> points;
+	for (int i = 0; i < 20; ++i) points.push_back(V2(px(rng), py(rng)));
+
+	int hitsVirtual = 0;
+	auto t0 = Clock::now();
+	for (const V2& p : points)
+		for (auto& obj : M.LObjets) hitsVirtual += obj->contains(p);
+	double tVirtual = elapsedUs(t0) / 1000;
+
+	int hitsVisitor = 0;
+	t0 = Clock::now();
+	for (const V2& p : points)
+	{
+		HitCounter H;
+		H.p = p;
+		M.store().visitAll(H);
+		hitsVisitor += H.hits;
+	}
+	double tVisitor = elapsedUs(t0) / 1000;
+
+	cout << setw(24) << "hit test (20 points)" << setw(14) << fixed << setprecision(1) << tVirtual << setw(14) << tVisitor;
+	if (hitsVirtual != hitsVisitor) cout << "  (different results !)";
+	cout << endl;
+
+	// tessellation of the whole scene
+	vector<GVertex> fill, lines;
+	t0 = Clock::now();
+	for (auto& obj : M.LObjets) obj->tessellate(fill, lines);
+	tVirtual = elapsedUs(t0) / 1000;
+
+	VertexCounter V;
+	t0 = Clock::now();
+	M.store().visitAll(V);
+	tVisitor = elapsedUs(t0) / 1000;
+
+	cout << setw(24) << "tessellation" << setw(14) << tVirtual << setw(14) << tVisitor;
+	if (fill.size() != V.fill.size() || lines.size() != V.lines.size()) cout << "  (different results !)";
+	cout << endl;
+
+	// text format
+	t0 = Clock::now();
+	string text;
+	for (auto& obj : M.LObjets) text += obj->serialize() + "\n";
+	tVirtual = elapsedUs(t0) / 1000;
+
+	t0 = Clock::now();
+	string text2 = sceneToString(M);
+	tVisitor = elapsedUs(t0) / 1000;
+
+	cout << setw(24) << "text serialization" << setw(14) << tVirtual << setw(14) << tVisitor;
+	if (text != text2) cout << "  (different results !)";
+	cout << endl;
+}
+
+// in eleve.cpp
+void drawApp(Graphics& G, const Model& D);
+
+void runRenderBenchmark()
+{
+	cout << endl << "Frame time of drawApp, software rasterizer 1600x800" << endl;
+	cout << setw(10) << "objects" << setw(14) << "full ms" << setw(14) << "scene kept ms" << setw(14) << "cached ms" << endl;
+
+	Model M;
+	mt19937 rng(1234);
+	SoftGraphics G(1600, 800);
+
+	for (int n : { 1000, 10000, 50000 })
+	{
+		V2 area;
+		fillScene(M, n, area, rng);
+
+		auto t0 = Clock::now();
+		M.damage.addAll();
+		drawApp(G, M);
+		double tFull = elapsedUs(t0) / 1000;
+
+		// tool or menu change : the whole window, the scene comes from its layer
+		t0 = Clock::now();
+		M.damage.addAll();
+		drawApp(G, M);
+		double tScene = elapsedUs(t0) / 1000;
+
+		// nothing modified : the frame comes from the cache
+		const int nbFrames = 20;
+		t0 = Clock::now();
+		for (int i = 0; i < nbFrames; ++i) drawApp(G, M);
+		double tCached = elapsedUs(t0) / 1000 / nbFrames;
+
+		cout << setw(10) << n << setw(14) << fixed << setprecision(2) << tFull << setw(14) << tScene << setw(14) << tCached << endl;
+	}
+}
+
+// in eleve.cpp
+void processEvent(const Event& Ev, Model& Data);
+void setDebugOutput(bool on);
+
+// segments drawn with a 1 kHz mouse : 50 moves, press, 200 moves, release
+static void dragSession(vector<Event>& events, mt19937& rng)
+{
+	uniform_int_distribution<int> px(100, 1500), py(150, 750);
+	for (int s = 0; s < 20; ++s)
+	{
+		V2 A(px(rng), py(rng)), B(px(rng), py(rng)), C(px(rng), py(rng));
+		for (int i = 1; i <= 50; ++i)  events.push_back(Event(EventType::MouseMove, A.x + (B.x - A.x) * i / 50, A.y + (B.y - A.y) * i / 50, ""));
+		events.push_back(Event(EventType::MouseDown, -1, -1, "0"));
+		for (int i = 1; i <= 200; ++i) events.push_back(Event(EventType::MouseMove, B.x + (C.x - B.x) * i / 200, B.y + (C.y - B.y) * i / 200, ""));
+		events.push_back(Event(EventType::MouseUp, -1, -1, "0"));
+	}
+}
+
+static string sceneText(const Model& M)
+{
+	string text;
+	for (auto& obj : M.LObjets) text += obj->serialize() + "\n";
+	return text;
+}
+
+void runEventQueueBenchmark()
+{
+	cout << endl << "Mouse drag at 1 kHz, one frame per event vs merged moves at 60 frames per second" << endl;
+	cout << setw(16) << "" << setw(10) << "events" << setw(10) << "frames" << setw(12) << "total ms" << endl;
+
+	vector<Event> session;
+	mt19937 rng(1234);
+	dragSession(session, rng);
+	setDebugOutput(false);
+
+	// as before : each event processed and drawn at once
+	Model M1;
+	SoftGraphics G1(1600, 800);
+	auto t0 = Clock::now();
+	for (const Event& E : session)
+	{
+		processEvent(E, M1);
+		drawApp(G1, M1);
+	}
+	double tDirect = elapsedUs(t0) / 1000;
+	cout << setw(16) << "every event" << setw(10) << session.size() << setw(10) << session.size()
+		<< setw(12) << fixed << setprecision(1) << tDirect << endl;
+
+	// 16 events per frame of 16 ms
+	Model M2;
+	SoftGraphics G2(1600, 800);
+	EventQueue Q;
+	vector<Event> pending;
+	int processed = 0, frames = 0;
+	t0 = Clock::now();
+	for (size_t i = 0; i < session.size(); i += 16)
+	{
+		for (size_t k = i; k < min(session.size(), i + 16); ++k) Q.push(session[k]);
+		Q.take(pending);
+		for (const Event& E : pending) processEvent(E, M2);
+		drawApp(G2, M2);
+		processed += (int)pending.size();
+		frames++;
+	}
+	double tQueue = elapsedUs(t0) / 1000;
+	cout << setw(16) << "merged moves" << setw(10) << processed << setw(10) << frames << setw(12) << tQueue;
+	if (sceneText(M1) != sceneText(M2)) cout << "  (different scenes !)";
+	cout << endl;
+
+	setDebugOutput(true);
+}
+
+void runTextBenchmark()
+{
+	cout << endl << "Stroke text, segments of a string built from the glyphs vs taken from the cache" << endl;
+	cout << setw(16) << "" << setw(14) << "us/string" << endl;
+
+	const int nbStrings = 5000;
+	size_t total = 0;
+
+	// a new string each time (as the numbers of the profiler overlay)
+	auto t0 = Clock::now();
+	for (int i = 0; i < nbStrings; ++i)
+		total += strokeTextSegments(StrokeFontId::MonoRoman, "objects drawn " + to_string(100000 + i), 13).size();
+	double tBuild = elapsedUs(t0) / nbStrings;
+
+	// the same string at every frame (tool name under the cursor)
+	t0 = Clock::now();
+	for (int i = 0; i < nbStrings; ++i)
+		total += strokeTextSegments(StrokeFontId::MonoRoman, "ToolSegment", 20).size();
+	double tCached = elapsedUs(t0) / nbStrings;
+
+	cout << setw(16) << "built" << setw(14) << fixed << setprecision(3) << tBuild << endl;
+	cout << setw(16) << "cached" << setw(14) << tCached << (total ? "" : "  (no segments !)") << endl;
+}
+
+void runBenchmarks()
+{
+	runPickBenchmark();
+	runControlPointBenchmark();
+	runPolyLineBenchmark();
+	runKernelBenchmark();
+	runIdBufferBenchmark();
+	runRegionSelectBenchmark();
+	runCircleBenchmark();
+	runZOrderBenchmark();
+	runDispatchBenchmark();
+	runSceneFileBenchmark();
+	runRenderBenchmark();
+	runEventQueueBenchmark();
+	runTextBenchmark();
+}
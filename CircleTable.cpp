@@ -0,0 +1,56 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+
+#include <cmath>
+#include "CircleTable.h"
+
+// Taylor series, enough terms for a float on [0, pi/2]
+static constexpr double sinSeries(double a)
+{
+	double term = a, sum = a;
+	for (int k = 1; k <= 9; ++k)
+	{
+		term *= -a * a / ((2 * k) * (2 * k + 1));
+		sum += term;
+	}
+	return sum;
+}
+
+static constexpr double cosSeries(double a)
+{
+	double term = 1, sum = 1;
+	for (int k = 1; k <= 9; ++k)
+	{
+		term *= -a * a / ((2 * k - 1) * (2 * k));
+		sum += term;
+	}
+	return sum;
+}
+
+// cos (pi/2 - a) = sin a : the series are only evaluated on [0, pi/4]
+constexpr CircleQuarterTable::CircleQuarterTable() : c(), s()
+{
+	const double HalfPi = 1.57079632679489661923;
+	for (int i = 0; i <= CircleQuarter / 2; ++i)
+	{
+		double a = HalfPi * i / CircleQuarter;
+		c[i] = s[CircleQuarter - i] = (float)cosSeries(a);
+		s[i] = c[CircleQuarter - i] = (float)sinSeries(a);
+	}
+}
+
+// constant initialization : the table is in the executable, nothing runs at startup
+const CircleQuarterTable CircleUnit = CircleQuarterTable();
+
+// the polygon of n sides is at r (1 - cos(pi / n)) from the circle
+int circleSides(float r, float tolerance)
+{
+	// numbers of sides available : sides / 4 divides CircleQuarter
+	static const int Sides[] = { 8, 12, 16, 24, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1536 };
+
+	if (r <= tolerance) return Sides[0];
+	double needed = 3.14159265358979 / acos(1 - tolerance / r);
+
+	for (int n : Sides)
+		if (n >= needed) return n;
+	return CircleMaxSides;
+}
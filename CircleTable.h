@@ -0,0 +1,41 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+// polygons used to draw the circles
+//
+// the vertices come from one quarter of the unit circle sampled at compile time, the
+// other quarters by symmetry : no cos / sin and no allocation per circle. A polygon has
+// a number of sides that divides CircleMaxSides, the smallest one whose distance to the
+// circle stays below the tolerance for the radius on screen.
+
+const int CircleMaxSides = 1536;
+const int CircleQuarter  = CircleMaxSides / 4;
+const float CircleTolerance = 0.25f;   // pixels
+
+struct CircleQuarterTable
+{
+	float c[CircleQuarter + 1];   // cos, sin of (pi/2) i / CircleQuarter
+	float s[CircleQuarter + 1];
+
+	constexpr CircleQuarterTable();
+};
+
+extern const CircleQuarterTable CircleUnit;
+
+// sides of the polygon for this radius (in pixels), multiple of 4, between 8 and CircleMaxSides
+int circleSides(float r, float tolerance = CircleTolerance);
+
+// the sides + 1 vertices of the polygon, counterclockwise from (cx + r, cy),
+// the last one closes the loop : out(x, y) for each of them
+template <class Out>
+void circlePoints(float cx, float cy, float r, int sides, Out out)
+{
+	const CircleQuarterTable& T = CircleUnit;
+	int step = CircleMaxSides / sides;
+
+	for (int i = 0; i < CircleQuarter; i += step) out(cx + r * T.c[i], cy + r * T.s[i]);
+	for (int i = 0; i < CircleQuarter; i += step) out(cx - r * T.s[i], cy + r * T.c[i]);
+	for (int i = 0; i < CircleQuarter; i += step) out(cx - r * T.c[i], cy - r * T.s[i]);
+	for (int i = 0; i < CircleQuarter; i += step) out(cx + r * T.s[i], cy - r * T.c[i]);
+	out(cx + r, cy);
+}
@@ -0,0 +1,232 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <string>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <iostream>
+#include "Model.h"
+#include "ObjGeom.h"
+#include "ObjAttr.h"
+
+using namespace std;
+
+// undo history : each edit is stored as a small command record
+// that knows how to apply and revert itself, instead of a copy of the scene
+
+class Command
+{
+public:
+	virtual ~Command() {}
+
+	virtual void apply(Model& Data)  = 0;
+	virtual void revert(Model& Data) = 0;
+
+	virtual string name() const = 0;
+
+	// memory held by this entry of the history
+	virtual size_t memoryBytes() const = 0;
+};
+
+////////////////////////////////////////////////////////////////////
+
+class CmdAddObject : public Command
+{
+	shared_ptr<ObjGeom> obj_;
+public:
+	CmdAddObject(shared_ptr<ObjGeom> obj) : obj_(obj) {}
+
+	void apply(Model& Data)  override { Data.addObject(obj_); }
+	void revert(Model& Data) override { Data.removeObject(obj_.get()); }
+
+	string name() const override { return "AddObject"; }
+	size_t memoryBytes() const override { return sizeof(*this); }  // the object lives in the scene
+};
+
+
+class CmdDeleteObject : public Command
+{
+	shared_ptr<ObjGeom> obj_;   // kept alive here, with its zOrder_, until the entry is dropped
+public:
+	CmdDeleteObject(shared_ptr<ObjGeom> obj) : obj_(obj) {}
+
+	void apply(Model& Data)  override { Data.removeObject(obj_.get()); }
+	void revert(Model& Data) override { Data.insertObject(obj_); }
+
+	string name() const override { return "DeleteObject"; }
+	size_t memoryBytes() const override { return sizeof(*this) + obj_->memoryBytes(); }
+};
+
+
+class CmdReorder : public Command
+{
+	shared_ptr<ObjGeom> obj_;
+	bool      toFront_;
+	long long oldZ_ = 0;
+public:
+	CmdReorder(shared_ptr<ObjGeom> obj, bool toFront) : obj_(obj), toFront_(toFront) {}
+
+	void apply(Model& Data) override
+	{
+		oldZ_ = obj_->zOrder_;
+		if (toFront_) Data.bringToFront(obj_.get());
+		else          Data.sendToBack(obj_.get());
+	}
+	void revert(Model& Data) override { Data.setZOrder(obj_.get(), oldZ_); }
+
+	string name() const override { return toFront_ ? "BringToFront" : "SendToBack"; }
+	size_t memoryBytes() const override { return sizeof(*this); }
+};
+
+
+class CmdEditPoint : public Command
+{
+	shared_ptr<ObjGeom> obj_;
+	size_t index_;
+	V2     before_, after_;
+
+public:
+	CmdEditPoint(shared_ptr<ObjGeom> obj, size_t index, V2 before, V2 after) :
+		obj_(obj), index_(index), before_(before), after_(after) {}
+
+	void apply(Model& Data)  override { Data.moveControlPoint(obj_.get(), index_, after_); }
+	void revert(Model& Data) override { Data.moveControlPoint(obj_.get(), index_, before_); }
+
+	string name() const override { return "EditPoint"; }
+	size_t memoryBytes() const override { return sizeof(*this); }
+};
+
+
+class CmdChangeAttributes : public Command
+{
+	shared_ptr<ObjGeom> obj_;
+	ObjAttr before_, after_;
+public:
+	CmdChangeAttributes(shared_ptr<ObjGeom> obj, ObjAttr after) :
+		obj_(obj), before_(obj->drawInfo_), after_(after) {}
+
+	void apply(Model& Data)  override { obj_->drawInfo_ = after_;  Data.objectChanged(obj_.get()); }
+	void revert(Model& Data) override { obj_->drawInfo_ = before_; Data.objectChanged(obj_.get()); }
+
+	string name() const override { return "ChangeAttributes"; }
+	size_t memoryBytes() const override { return sizeof(*this); }
+};
+
+
+// clear or load : the whole list changes, only the pointers are kept
+class CmdReplaceScene : public Command
+{
+	vector< shared_ptr<ObjGeom> > before_, after_;
+public:
+	CmdReplaceScene(const vector< shared_ptr<ObjGeom> >& before, const vector< shared_ptr<ObjGeom> >& after) :
+		before_(before), after_(after)
+	{
+		long long z = 0;
+		for (auto& obj : after_) obj->zOrder_ = ++z;
+	}
+
+	void apply(Model& Data)  override { Data.replaceObjects(after_); }
+	void revert(Model& Data) override { Data.replaceObjects(before_); }
+
+	string name() const override { return "ReplaceScene"; }
+	size_t memoryBytes() const override
+	{
+		size_t total = sizeof(*this) + (before_.capacity() + after_.capacity()) * sizeof(shared_ptr<ObjGeom>);
+		for (auto& obj : before_) total += obj->memoryBytes();   // no longer in the scene
+		return total;
+	}
+};
+
+// several edits undone in one step (operations on a multiple selection)
+// reverted in the reverse order, so that each command finds the state it left
+class CmdGroup : public Command
+{
+	vector< unique_ptr<Command> > cmds_;
+public:
+	void add(unique_ptr<Command> cmd) { cmds_.push_back(move(cmd)); }
+	bool empty() const { return cmds_.empty(); }
+
+	void apply(Model& Data) override
+	{
+		for (auto& cmd : cmds_) cmd->apply(Data);
+	}
+	void revert(Model& Data) override
+	{
+		for (auto it = cmds_.rbegin(); it != cmds_.rend(); ++it) (*it)->revert(Data);
+	}
+
+	string name() const override
+	{
+		if (cmds_.empty()) return "Group";
+		return "Group " + to_string(cmds_.size()) + " x " + cmds_.front()->name();
+	}
+	size_t memoryBytes() const override
+	{
+		size_t total = sizeof(*this) + cmds_.capacity() * sizeof(unique_ptr<Command>);
+		for (auto& cmd : cmds_) total += cmd->memoryBytes();
+		return total;
+	}
+};
+
+////////////////////////////////////////////////////////////////////
+
+class UndoStack
+{
+	// the size counted at push time, memoryBytes() changes with the capacities of the objects
+	struct Entry
+	{
+		unique_ptr<Command> cmd;
+		size_t              bytes;
+	};
+
+	deque<Entry> entries_;
+	size_t maxEntries_;
+	size_t totalBytes_ = 0;
+
+	void push(unique_ptr<Command> cmd)
+	{
+		size_t bytes = cmd->memoryBytes();
+		totalBytes_ += bytes;
+		if (verbose)
+			cout << "undo : " << cmd->name() << " " << bytes << " bytes (" << entries_.size() + 1
+				<< " entries, " << totalBytes_ << " bytes)" << endl;
+
+		entries_.push_back(Entry{ move(cmd), bytes });
+		if (entries_.size() > maxEntries_)
+		{
+			totalBytes_ -= entries_.front().bytes;
+			entries_.pop_front();
+			PoolBase::trimAll();   // the objects of a cleared scene may be freed only now
+		}
+	}
+
+public:
+	bool verbose = true;   // prints each new entry
+
+	// same bound as the former scene snapshots : a CmdReplaceScene keeps a whole scene
+	UndoStack(size_t maxEntries = 50) : maxEntries_(maxEntries) {}
+
+	// apply a new edit and store it
+	void execute(unique_ptr<Command> cmd, Model& Data)
+	{
+		cmd->apply(Data);
+		push(move(cmd));
+	}
+
+	// store an edit that has already been applied (ex : a point dragged with the mouse)
+	void record(unique_ptr<Command> cmd) { push(move(cmd)); }
+
+	void undo(Model& Data)
+	{
+		if (entries_.empty()) return;
+		totalBytes_ -= entries_.back().bytes;
+		entries_.back().cmd->revert(Data);
+		entries_.pop_back();
+		PoolBase::trimAll();
+	}
+
+	bool   empty()      const { return entries_.empty(); }
+	size_t size()       const { return entries_.size(); }
+	size_t totalBytes() const { return totalBytes_; }
+};
@@ -0,0 +1,97 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include "V2.h"
+
+// uniform grid over the control points of the scene objects (see ToolEditPoints)
+// each entry is a point of an object : its store slot and its index in getControlPoints(),
+// so grabbing a point or listing the visible handles only reads the cells concerned.
+// Maintained by Model, a moved point changes of cell only if it crosses a cell border.
+
+class ControlPointIndex
+{
+public:
+	struct Entry
+	{
+		uint32_t slot;
+		uint32_t point;
+		V2       p;
+	};
+
+private:
+	static const int CellSize = 32;   // pixels
+
+	std::unordered_map<long long, std::vector<Entry>> cells_;
+	size_t count_ = 0;
+
+	static int cellOf(int v) { return (v >= 0) ? v / CellSize : -((-v + CellSize - 1) / CellSize); }
+	static long long key(int cx, int cy) { return ((long long)cx << 32) ^ (unsigned int)cy; }
+
+	Entry* findEntry(std::vector<Entry>& L, uint32_t slot, uint32_t point)
+	{
+		for (Entry& E : L)
+			if (E.slot == slot && E.point == point) return &E;
+		return nullptr;
+	}
+
+public:
+
+	size_t size() const { return count_; }
+
+	void insert(uint32_t slot, uint32_t point, V2 p)
+	{
+		cells_[key(cellOf(p.x), cellOf(p.y))].push_back({ slot, point, p });
+		count_++;
+	}
+
+	// p : position given at insertion or at the last move
+	void remove(uint32_t slot, uint32_t point, V2 p)
+	{
+		auto c = cells_.find(key(cellOf(p.x), cellOf(p.y)));
+		if (c == cells_.end()) return;
+
+		std::vector<Entry>& L = c->second;
+		Entry* E = findEntry(L, slot, point);
+		if (!E) return;
+		*E = L.back();
+		L.pop_back();
+		if (L.empty()) cells_.erase(c);
+		count_--;
+	}
+
+	void move(uint32_t slot, uint32_t point, V2 from, V2 to)
+	{
+		if (cellOf(from.x) == cellOf(to.x) && cellOf(from.y) == cellOf(to.y))
+		{
+			auto c = cells_.find(key(cellOf(from.x), cellOf(from.y)));
+			if (c == cells_.end()) return;
+			if (Entry* E = findEntry(c->second, slot, point)) E->p = to;
+			return;
+		}
+		remove(slot, point, from);
+		insert(slot, point, to);
+	}
+
+	void clear()
+	{
+		cells_.clear();
+		count_ = 0;
+	}
+
+	// points in the region P/size, borders included, in no particular order
+	void query(V2 P, V2 size, std::vector<Entry>& out) const
+	{
+		int x1 = P.x + size.x, y1 = P.y + size.y;
+		for (int cx = cellOf(P.x); cx <= cellOf(x1); ++cx)
+			for (int cy = cellOf(P.y); cy <= cellOf(y1); ++cy)
+			{
+				auto c = cells_.find(key(cx, cy));
+				if (c == cells_.end()) continue;
+				for (const Entry& E : c->second)
+					if (E.p.x >= P.x && E.p.x <= x1 && E.p.y >= P.y && E.p.y <= y1) out.push_back(E);
+			}
+	}
+};
@@ -11,48 +11,142 @@
 #include "Model.h"
 #include "Button.h"
 #include "Tool.h"
+#include "SceneFile.h"
+#include "SceneRenderer.h"
+#include "SoftGraphics.h"
+#include "EventLog.h"
+#include "Profiler.h"
 
 using namespace std;
 Color gBackgroundColor = Color::Black;
-static std::vector<std::string> gHistory;
+static UndoStack gHistory;
 static std::shared_ptr<Tool> gPreviousTool;
+static std::string gSceneFile = "scene.txt";   // .pbin => binary format
+static SceneRenderer gSceneRenderer;
+static bool gPrintEvents = true;
+static Profiler gProfiler;
+static std::string gProfileFile;   // csv written at exit
 
 
+// one line per object of the store, in drawing order
+struct TextWriter
+{
+	std::ostream& ss;
+
+	void operator()(const SceneStore::RectRef& o)     { ObjRectangle::write(ss, o.attr, o.P1, o.P2); }
+	void operator()(const SceneStore::SegmentRef& o)  { ObjSegment::write(ss, o.attr, o.P1, o.P2); }
+	void operator()(const SceneStore::CircleRef& o)   { ObjCircle::write(ss, o.attr, o.C, o.P2); }
+	void operator()(const SceneStore::PolyLineRef& o) { ObjPolyLine::write(ss, o.attr, o.pts, o.n); }
+};
+
 std::string sceneToString(const Model& Data)
 {
 	std::ostringstream ss;
-	for (auto& obj : Data.LObjets)
+	TextWriter W = { ss };
+	for (auto& e : Data.store().order())
 	{
-		if (obj) ss << obj->serialize() << "\n";
+		Data.store().visit(e.second, W);
+		ss << "\n";
 	}
 	return ss.str();
 }
 
-void stringToScene(const std::string& snapshot, Model& Data)
+std::vector<std::shared_ptr<ObjGeom>> stringToObjects(const std::string& text)
 {
-	std::istringstream in(snapshot);
-	Data.LObjets.clear();
+	std::istringstream in(text);
+	std::vector<std::shared_ptr<ObjGeom>> objects;
 
 	std::string line;
 	while (std::getline(in, line))
 	{
 		auto obj = ObjGeom::deserialize(line);
-		if (obj) Data.LObjets.push_back(obj);
+		if (obj) objects.push_back(obj);
 	}
+	return objects;
+}
+
+void executeCommand(Model& Data, unique_ptr<Command> cmd)
+{
+	gHistory.execute(move(cmd), Data);
 }
 
-void saveSceneSnapshot(Model& Data)
+void recordCommand(unique_ptr<Command> cmd)
 {
-	gHistory.push_back(sceneToString(Data));
+	gHistory.record(move(cmd));
+}
+
+// console trace of the events and undo entries, off during a replay
+void setDebugOutput(bool on)
+{
+	gPrintEvents = on;
+	gHistory.verbose = on;
+}
 
-	if (gHistory.size() > 50)
-		gHistory.erase(gHistory.begin());
+// when the selection tool holds objects, the style buttons also apply to them
+void applyToSelection(Model& Data, function<void(ObjAttr&)> change)
+{
+	ToolSelect* ts = dynamic_cast<ToolSelect*>(Data.currentTool.get());
+	if (ts) ts->changeAttributes(Data, change);
 }
 
 //		setup screen
 
+void runBenchmarks();
+void drawApp(Graphics& G, const Model& D);
+void bntLoadScene(Model& Data);
+
+// draw a scene file into an image, without window
+int exportScene(const string& sceneFile, const string& imageFile)
+{
+	Model Data;
+	gSceneFile = sceneFile;
+	bntLoadScene(Data);
+
+	SoftGraphics G(1600, 800);
+	drawApp(G, Data);
+
+	if (!G.savePPM(imageFile)) { cout << "Cannot write " << imageFile << endl; return 1; }
+	cout << "Scene " << sceneFile << " (" << Data.LObjets.size() << " objects) exported to " << imageFile << endl;
+	return 0;
+}
+
+void saveProfile()
+{
+	if (gProfiler.saveCSV(gProfileFile)) cout << "Frame profile written to " << gProfileFile << endl;
+}
+
 int main(int argc, char* argv[])
 {
+	vector<string> args(argv + 1, argv + argc);
+
+	if (args.size() > 1 && args[0] == "--profile")
+	{
+		gProfileFile = args[1];
+		atexit(saveProfile);
+		args.erase(args.begin(), args.begin() + 2);
+	}
+
+	if (args.size() > 0 && args[0] == "--bench")
+	{
+		runBenchmarks();
+		return 0;
+	}
+
+	if (args.size() > 2 && args[0] == "--export")
+		return exportScene(args[1], args[2]);
+
+	if (args.size() > 1 && args[0] == "--replay")
+		return replayEvents(args[1], args.size() > 2 ? args[2] : "");
+
+	if (args.size() > 1 && args[0] == "--record")
+	{
+		if (!startEventRecording(args[1])) { cout << "Cannot write " << args[1] << endl; return 1; }
+		args.erase(args.begin(), args.begin() + 2);
+	}
+
+	// file used by the Save/Load buttons
+	if (args.size() > 0) gSceneFile = args[0];
+
 	std::cout << "Press ESC to abort" << endl;
 	Graphics::initMainWindow("Pictor", V2(1600, 800), V2(200, 200));
 }
@@ -65,14 +159,13 @@ void bntToolDelete(Model& Data)
 	if (Data.currentTool)
 	{
 		ToolSelect* ts = dynamic_cast<ToolSelect*>(Data.currentTool.get());
-		if (ts && ts->getSelected())
+		if (ts && ts->hasSelection())
 		{
 			ts->deleteSelection(Data);
 			return;
 		}
 	}
-	saveSceneSnapshot(Data); 
-	Data.LObjets.clear();
+	executeCommand(Data, make_unique<CmdReplaceScene>(Data.LObjets.toVector(), std::vector<std::shared_ptr<ObjGeom>>()));
 }
 
 
@@ -102,6 +195,7 @@ void bntCycleBorderColor(Model& Data)
 	Color colors[] = { Color::Red, Color::Green, Color::Blue, Color::Cyan, Color::Magenta, Color::Yellow, Color::Black };
 	idx = (idx + 1) % 7;
 	Data.drawingOptions.borderColor_ = colors[idx];
+	applyToSelection(Data, [&](ObjAttr& A) { A.borderColor_ = colors[idx]; });
 }
 
 void bntCycleFillColor(Model& Data)
@@ -110,6 +204,7 @@ void bntCycleFillColor(Model& Data)
 	Color colors[] = { Color::White, Color::Red, Color::Green, Color::Blue, Color::Cyan, Color::Magenta, Color::Yellow };
 	idx = (idx + 1) % 7;
 	Data.drawingOptions.interiorColor_ = colors[idx];
+	applyToSelection(Data, [&](ObjAttr& A) { A.interiorColor_ = colors[idx]; });
 }
 
 void bntCycleThickness(Model& Data)
@@ -118,11 +213,13 @@ void bntCycleThickness(Model& Data)
 	int thicknesses[] = { 1, 2, 3, 5 };
 	idx = (idx + 1) % 4;
 	Data.drawingOptions.thickness_ = thicknesses[idx];
+	applyToSelection(Data, [&](ObjAttr& A) { A.thickness_ = thicknesses[idx]; });
 }
 
 void bntToggleFilled(Model& Data)
 {
 	Data.drawingOptions.isFilled_ = !Data.drawingOptions.isFilled_;
+	applyToSelection(Data, [&](ObjAttr& A) { A.isFilled_ = Data.drawingOptions.isFilled_; });
 }
  
 void bntToolPolygonClick(Model& Data)
@@ -131,7 +228,13 @@ void bntToolPolygonClick(Model& Data)
 }
 
 void bntSaveScene(Model& Data) {
-	std::ofstream out("scene.txt");
+	if (isBinarySceneFile(gSceneFile))
+	{
+		saveBinaryScene(gSceneFile, Data.store());
+		return;
+	}
+
+	std::ofstream out(gSceneFile);
 	if (!out) return;
 
 	out << sceneToString(Data);   
@@ -139,25 +242,27 @@ void bntSaveScene(Model& Data) {
 
 void bntLoadScene(Model& Data)
 {
-	std::ifstream in("scene.txt");
-	if (!in) return;
+	std::vector<std::shared_ptr<ObjGeom>> objects;
 
-	saveSceneSnapshot(Data); 
+	if (isBinarySceneFile(gSceneFile))
+	{
+		if (!loadBinaryScene(gSceneFile, objects)) return;
+	}
+	else
+	{
+		std::ifstream in(gSceneFile);
+		if (!in) return;
 
-	std::ostringstream buffer;
-	buffer << in.rdbuf();
-	string snapshot = buffer.str();
+		std::ostringstream buffer;
+		buffer << in.rdbuf();
+		objects = stringToObjects(buffer.str());
+	}
 
-	stringToScene(snapshot, Data);
+	executeCommand(Data, make_unique<CmdReplaceScene>(Data.LObjets.toVector(), objects));
 }
 
 void bntUndo(Model& Data) {
-	if (gHistory.empty()) { return; }
-
-	std::string snapshot = gHistory.back();
-	gHistory.pop_back();
-
-	stringToScene(snapshot, Data);
+	gHistory.undo(Data);
 }
 
 void bntEditPoints(Model& Data)
@@ -290,14 +395,12 @@ void initApp(Model& App)
 
 	// put two objets in the scene
 	ObjAttr DrawOpt1 = ObjAttr(Color::Cyan, true, Color::Green, 6);
-	auto newObj1 = make_shared<ObjRectangle>(DrawOpt1, V2(100, 100), V2(300, 200));
-	App.LObjets.push_back(newObj1);
+	auto newObj1 = makeObject<ObjRectangle>(DrawOpt1, V2(100, 100), V2(300, 200));
+	App.addObject(newObj1);
 
 	ObjAttr DrawOpt2 = ObjAttr(Color::Red, true, Color::Blue, 5);
-	auto newObj2 = make_shared<ObjRectangle>(DrawOpt2, V2(500, 300), V2(600, 600));
-	App.LObjets.push_back(newObj2);
-
-	saveSceneSnapshot(App);
+	auto newObj2 = makeObject<ObjRectangle>(DrawOpt2, V2(500, 300), V2(600, 600));
+	App.addObject(newObj2);
 }
 
 /////////////////////////////////////////////////////////////////////////
@@ -307,7 +410,15 @@ void initApp(Model& App)
  
 void processEvent(const Event& Ev, Model & Data)
 {
-	Ev.print(); // Debug
+	ProfileScope profile(gProfiler, Phase::Event);
+	if (gPrintEvents) Ev.print(); // Debug
+
+	// F3 : profiler overlay
+	if (Ev.Type == EventType::KeyDown && Ev.info == "F3")
+	{
+		gProfiler.showOverlay = !gProfiler.showOverlay;
+		return;
+	}
 
 	// MouseMove event updates x,y coordinates
 	if (Ev.Type == EventType::MouseMove ) Data.currentMousePos = V2(Ev.x, Ev.y);
@@ -316,10 +427,11 @@ void processEvent(const Event& Ev, Model & Data)
 	// detect a mouse click on the tools icons
 
 	V2 P = Data.currentMousePos;
-	for (auto B : Data.LButtons)
+	for (auto& B : Data.LButtons)
 		if (Ev.Type == EventType::MouseDown && P.isInside(B->getPos(),B->getSize()) )
 		{
 			B->manageEvent(Ev,Data);
+			Data.damage.addAll();   // tool, options or background may have changed
 			return;
 		}
 
@@ -372,26 +484,150 @@ void drawCursor(Graphics& G, const Model& D)
 	
 }
 
-void drawApp(Graphics& G, const Model & D)
+// what the scene layer of the frame cache was drawn for
+struct SceneLayerKey
+{
+	bool               valid = false;
+	const Model*       model = nullptr;
+	unsigned long long revision = 0;
+	V2                 view;
+	Color              background;
+
+	bool matches(Graphics& G, const Model& D, V2 viewSize) const
+	{
+		return valid && G.hasFrame(FrameLayer::Scene) && model == &D && revision == D.revision() && view.x == viewSize.x && view.y == viewSize.y
+			&& background.R == gBackgroundColor.R && background.G == gBackgroundColor.G
+			&& background.B == gBackgroundColor.B && background.A == gBackgroundColor.A;
+	}
+};
+static SceneLayerKey gSceneLayer;
+
+// background and objects : kept in the scene layer of the frame cache
+static void drawSceneLayer(Graphics& G, const Model& D)
 {
 	// reset with a black background
-	G.clearWindow(gBackgroundColor);
+	{
+		ProfileScope profile(gProfiler, Phase::Clear);
+		G.clearWindow(gBackgroundColor);
+	}
 
-	// draw all geometric objects
-	for (auto& Obj : D.LObjets)
-		Obj->draw(G);
+	// draw all geometric objects, in a few batches
+	ProfileScope profile(gProfiler, Phase::Objects);
+	gSceneRenderer.draw(G, D);
+	gProfiler.set(Counter::ObjectsDrawn, gSceneRenderer.drawn());
+	gProfiler.set(Counter::ObjectsCulled, gSceneRenderer.culled());
+}
 
+// menu and tool layer, drawn over the scene
+static void drawInterfaceLayer(Graphics& G, const Model& D)
+{
 	// draw the app menu
-	for (auto& myButton : D.LButtons)
-		myButton->draw(G);
+	{
+		ProfileScope profile(gProfiler, Phase::Buttons);
+		for (auto& myButton : D.LButtons)
+			myButton->draw(G);
+	}
+
+	ProfileScope profile(gProfiler, Phase::ToolLayer);
+	D.currentTool->drawLayer(G, D);
+}
+
+static void drawFrame(Graphics& G, const Model & D)
+{
+	Damage& damage = D.damage;
+	D.setViewSize(G.getWindowSize());
+
+	// many small regions : draw their union once
+	if (damage.rects.size() > 4)
+	{
+		V2 A = damage.rects[0].first, B = A;
+		for (auto& R : damage.rects)
+		{
+			A = V2(min(A.x, R.first.x), min(A.y, R.first.y));
+			B = V2(max(B.x, R.first.x + R.second.x), max(B.y, R.first.y + R.second.y));
+		}
+		damage.rects = { { A, B - A } };
+	}
+
+	// everything that does not move with the mouse is kept in the frame cache, the scene
+	// alone in its own layer : a change of tool, option or menu does not draw it again
+	if (damage.full)
+	{
+		V2 W = G.getWindowSize();
+		if (gSceneLayer.matches(G, D, W))
+		{
+			ProfileScope profile(gProfiler, Phase::FrameCache);
+			G.restoreFrame(FrameLayer::Scene);
+		}
+		else
+		{
+			drawSceneLayer(G, D);
+			ProfileScope profile(gProfiler, Phase::FrameCache);
+			G.saveFrame(V2(0, 0), W, FrameLayer::Scene);
+			gSceneLayer.valid = true;
+			gSceneLayer.model = &D;
+			gSceneLayer.revision = D.revision();
+			gSceneLayer.view = W;
+			gSceneLayer.background = gBackgroundColor;
+		}
+
+		drawInterfaceLayer(G, D);
+		ProfileScope profile(gProfiler, Phase::FrameCache);
+		G.saveFrame(V2(0, 0), W);
+	}
+	else
+	{
+		// previous frame without the cursor and the tool preview
+		{
+			ProfileScope profile(gProfiler, Phase::FrameCache);
+			G.restoreFrame();
+		}
+
+		// then only the regions modified since, in both layers
+		for (auto& R : damage.rects)
+		{
+			G.setClip(R.first, R.second);
+			drawSceneLayer(G, D);
+			{
+				ProfileScope profile(gProfiler, Phase::FrameCache);
+				G.saveFrame(R.first, R.second, FrameLayer::Scene);
+			}
+			drawInterfaceLayer(G, D);
+			ProfileScope profile(gProfiler, Phase::FrameCache);
+			G.saveFrame(R.first, R.second);
+		}
+		G.resetClip();
+		if (!damage.rects.empty()) gSceneLayer.revision = D.revision();
+	}
+	damage.clear();
 
 	// draw current tool and interface (if active)
-	D.currentTool->draw(G, D);
+	{
+		ProfileScope profile(gProfiler, Phase::ToolOverlay);
+		D.currentTool->draw(G, D);
+	}
 
 	// draw cursor
+	ProfileScope profile(gProfiler, Phase::Cursor);
 	drawCursor(G, D);
 }
 
+void drawApp(Graphics& G, const Model & D)
+{
+	long long issued0, skipped0, issued1, skipped1;
+	G.getStateChanges(issued0, skipped0);
+	{
+		ProfileScope profile(gProfiler, Phase::Frame);
+		drawFrame(G, D);
+	}
+	G.getStateChanges(issued1, skipped1);
+	gProfiler.set(Counter::StateChanges, (double)(issued1 - issued0));
+	gProfiler.set(Counter::StatesSkipped, (double)(skipped1 - skipped0));
+	gProfiler.endFrame();
+
+	if (gProfiler.showOverlay) gProfiler.draw(G);
+}
+
  
 
 
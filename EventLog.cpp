@@ -0,0 +1,216 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include "EventLog.h"
+#include "Model.h"
+#include "SoftGraphics.h"
+
+using namespace std;
+
+typedef chrono::high_resolution_clock Clock;
+
+static const int VERSION = 1;
+static const string TypeNames[] = { "MouseMove", "MouseDown", "MouseUp", "KeyDown", "KeyUp" };
+static const int NbTypes = 5;
+
+// in eleve.cpp
+void processEvent(const Event& Ev, Model& Data);
+void drawApp(Graphics& G, const Model& D);
+void setDebugOutput(bool on);
+
+/////////////////////////////////////////////////////////////
+//
+//	    Info escaping
+//
+/////////////////////////////////////////////////////////////
+
+// spaces, control characters and % are written as %XX, an empty info as %
+static string escapeInfo(const string& s)
+{
+	if (s.empty()) return "%";
+
+	static const char hex[] = "0123456789ABCDEF";
+	string r;
+	for (unsigned char c : s)
+		if (c <= ' ' || c == '%' || c >= 0x7F)
+		{
+			r += '%';
+			r += hex[c >> 4];
+			r += hex[c & 15];
+		}
+		else r += (char)c;
+	return r;
+}
+
+static string unescapeInfo(const string& s)
+{
+	if (s == "%") return "";
+
+	string r;
+	for (size_t i = 0; i < s.size(); ++i)
+		if (s[i] == '%' && i + 2 < s.size())
+		{
+			r += (char)stoi(s.substr(i + 1, 2), nullptr, 16);
+			i += 2;
+		}
+		else r += s[i];
+	return r;
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Recording
+//
+/////////////////////////////////////////////////////////////
+
+static ofstream          gRecordFile;   // flushed by its destructor when ESC calls exit()
+static Clock::time_point gRecordStart;
+
+bool startEventRecording(const string& filename)
+{
+	gRecordFile.open(filename);
+	if (!gRecordFile) return false;
+
+	gRecordFile << "PICTOR-EVENTS " << VERSION << "\n";
+	gRecordStart = Clock::now();
+	return true;
+}
+
+void recordEvent(const Event& ev)
+{
+	if (!gRecordFile.is_open()) return;
+
+	double t = chrono::duration<double, milli>(Clock::now() - gRecordStart).count();
+	gRecordFile << fixed << setprecision(3) << t << " " << TypeNames[(int)ev.Type] << " "
+		<< ev.x << " " << ev.y << " " << escapeInfo(ev.info) << "\n";
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Loading
+//
+/////////////////////////////////////////////////////////////
+
+bool loadEventLog(const string& filename, vector<LoggedEvent>& events)
+{
+	ifstream in(filename);
+	if (!in) return false;
+
+	string magic;
+	int version = 0;
+	in >> magic >> version;
+	if (magic != "PICTOR-EVENTS" || version != VERSION) return false;
+
+	string line;
+	getline(in, line);
+	while (getline(in, line))
+	{
+		if (line.empty()) continue;
+
+		istringstream ss(line);
+		double t;
+		string type, info;
+		int x, y;
+		if (!(ss >> t >> type >> x >> y >> info)) return false;
+
+		int k = (int)(find(TypeNames, TypeNames + NbTypes, type) - TypeNames);
+		if (k == NbTypes) return false;
+
+		events.push_back({ t, Event((EventType)k, x, y, unescapeInfo(info)) });
+	}
+	return true;
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Replay
+//
+/////////////////////////////////////////////////////////////
+
+static double percentile(vector<double> v, double p)
+{
+	if (v.empty()) return 0;
+	size_t k = min(v.size() - 1, (size_t)(p * v.size()));
+	nth_element(v.begin(), v.begin() + k, v.end());
+	return v[k];
+}
+
+static void printStats(const string& name, const vector<double>& v)
+{
+	if (v.empty()) return;
+
+	double total = 0, worst = 0;
+	for (double t : v) { total += t; worst = max(worst, t); }
+
+	cout << setw(12) << name << setw(8) << v.size() << fixed << setprecision(1)
+		<< setw(12) << total / v.size() << setw(10) << percentile(v, 0.5) << setw(10) << percentile(v, 0.95)
+		<< setw(10) << worst << setw(12) << setprecision(2) << total / 1000 << endl;
+}
+
+int replayEvents(const string& filename, const string& csvFile)
+{
+	vector<LoggedEvent> events;
+	if (!loadEventLog(filename, events))
+	{
+		cout << "Invalid event log " << filename << endl;
+		return 1;
+	}
+
+	setDebugOutput(false);
+	Model Data;
+	SoftGraphics G(1600, 800);
+	drawApp(G, Data);
+
+	// as in the window : one frame after each event
+	vector<double> tEvent(events.size()), tFrame(events.size());
+	auto tStart = Clock::now();
+	for (size_t i = 0; i < events.size(); ++i)
+	{
+		auto t0 = Clock::now();
+		processEvent(events[i].ev, Data);
+		auto t1 = Clock::now();
+		drawApp(G, Data);
+		auto t2 = Clock::now();
+
+		tEvent[i] = chrono::duration<double, micro>(t1 - t0).count();
+		tFrame[i] = chrono::duration<double, micro>(t2 - t1).count();
+	}
+	double tReplay = chrono::duration<double, milli>(Clock::now() - tStart).count();
+	double tSession = events.empty() ? 0 : events.back().time;
+
+	cout << "Replay of " << filename << " : " << events.size() << " events, "
+		<< Data.LObjets.size() << " objects at the end" << endl;
+	cout << fixed << setprecision(1) << "session " << tSession << " ms, replay " << tReplay << " ms" << endl << endl;
+
+	cout << setw(12) << "" << setw(8) << "count" << setw(12) << "mean us" << setw(10) << "p50 us"
+		<< setw(10) << "p95 us" << setw(10) << "max us" << setw(12) << "total ms" << endl;
+	for (int k = 0; k < NbTypes; ++k)
+	{
+		vector<double> v;
+		for (size_t i = 0; i < events.size(); ++i)
+			if ((int)events[i].ev.Type == k) v.push_back(tEvent[i]);
+		printStats(TypeNames[k], v);
+	}
+	printStats("all events", tEvent);
+	printStats("frames", tFrame);
+
+	if (!csvFile.empty())
+	{
+		ofstream csv(csvFile);
+		csv << "index,time_ms,type,x,y,info,event_us,frame_us\n";
+		for (size_t i = 0; i < events.size(); ++i)
+		{
+			const Event& ev = events[i].ev;
+			csv << i << "," << fixed << setprecision(3) << events[i].time << "," << TypeNames[(int)ev.Type] << ","
+				<< ev.x << "," << ev.y << "," << escapeInfo(ev.info) << ","
+				<< setprecision(1) << tEvent[i] << "," << tFrame[i] << "\n";
+		}
+		cout << endl << "Timings written to " << csvFile << endl;
+	}
+	return 0;
+}
@@ -0,0 +1,37 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <string>
+#include <vector>
+#include "Event.h"
+
+using namespace std;
+
+// event log : the input events of an editing session, one line per event
+//
+//   first line : PICTOR-EVENTS <version>
+//   then       : <time ms> <type> <x> <y> <info>
+//
+// the time is counted from the start of the recording, the type is the name
+// printed by Event::print() and the info is escaped (%XX) to stay on one word
+
+struct LoggedEvent
+{
+	double time;   // ms
+	Event  ev;
+};
+
+// starts logging every event received by the window, false if the file cannot be created
+bool startEventRecording(const string& filename);
+
+// called for each event processed by the window (after merging the mouse moves, see
+// EventQueue), does nothing when not recording
+void recordEvent(const Event& ev);
+
+// returns false if the file is missing or invalid
+bool loadEventLog(const string& filename, vector<LoggedEvent>& events);
+
+// feeds the logged events to processEvent() / drawApp() without window, at maximum speed,
+// and prints the processing time of the events and the render time of the frames
+// the timings of each event are written to csvFile if not empty
+int replayEvents(const string& filename, const string& csvFile);
@@ -0,0 +1,47 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <vector>
+#include "Event.h"
+
+using namespace std;
+
+// input events waiting for the next frame
+//
+// the mouse sends its positions much faster than the screen is refreshed : a mouse move
+// following another one replaces it, only the last position before a press, a release
+// or a key is processed. The other events are kept, in their order of arrival.
+
+class EventQueue
+{
+	vector<Event> events_;
+	long long received_ = 0;
+	long long merged_   = 0;
+
+public:
+
+	void push(const Event& E)
+	{
+		received_++;
+		if (E.Type == EventType::MouseMove && !events_.empty() && events_.back().Type == EventType::MouseMove)
+		{
+			events_.back() = E;
+			merged_++;
+			return;
+		}
+		events_.push_back(E);
+	}
+
+	bool empty() const { return events_.empty(); }
+
+	// moves the pending events into out and empties the queue
+	void take(vector<Event>& out)
+	{
+		out.clear();
+		out.swap(events_);
+	}
+
+	// events pushed, mouse moves replaced by a later one
+	long long received() const { return received_; }
+	long long merged()   const { return merged_; }
+};
@@ -6,6 +6,8 @@
 #include "color.h"
 #include "Event.h"
 #include "Model.h"
+#include "EventLog.h"
+#include "EventQueue.h"
 
 
 ///////////////////////////////////////////////
@@ -28,17 +30,42 @@ namespace GL
 	void AskScreenRedraw();
 };
 
-void myglEvent(Event& V)
+// the GLUT callbacks only queue the events, they are processed once per frame
+static EventQueue    InputQueue;
+static vector<Event> PendingEvents;
+static const int     FramePeriodMs = 16;   // about 60 frames per second
+static int           NextFrameMs = 0;
+
+void myglEvent(const Event& V)
 {
-	
-	processEvent(V, Data);
-	GL::AskScreenRedraw();
+	InputQueue.push(V);
+}
+
+// frame pacing : the events received since the previous frame, then a single redraw
+// the timer is armed again for the next frame, skipped frames are not caught up
+void GLFrameTick(int)
+{
+	if (!InputQueue.empty())
+	{
+		InputQueue.take(PendingEvents);
+		for (const Event& E : PendingEvents)
+		{
+			recordEvent(E);
+			processEvent(E, Data);
+		}
+		GL::AskScreenRedraw();
+	}
+
+	int now = glutGet(GLUT_ELAPSED_TIME);
+	NextFrameMs += FramePeriodMs;
+	if (NextFrameMs < now) NextFrameMs = now;
+	glutTimerFunc(NextFrameMs - now, GLFrameTick, 0);
 }
 
  
 void GLRender()
 {
-	Graphics G;
+	GLGraphics G;
     drawApp(G, Data);
 	GL::Show();
 }
@@ -78,6 +105,7 @@ namespace GL
 	void reshape(int w, int h)
 	{
 		glutReshapeWindow(Wsize.x, Wsize.y);
+		Data.damage.addAll();
 	}
 
 	void KeyPressed(unsigned char key, int x, int y)
@@ -184,6 +212,7 @@ namespace GL
 		
 		glEnable(GL_LINE_SMOOTH);
 		glLineWidth(1);
+		GLGraphics::invalidateState();   // set without the state cache
 
 		// glEnable(GL_POLYGON_SMOOTH);  viter rendu erron
 
@@ -201,9 +230,11 @@ namespace GL
 		glutPassiveMotionFunc(mouseMove);
 		glutMouseFunc(mouse);
 
+		// events processed and window drawn once per frame
+		NextFrameMs = glutGet(GLUT_ELAPSED_TIME) + FramePeriodMs;
+		glutTimerFunc(FramePeriodMs, GLFrameTick, 0);
 
 		glutDisplayFunc(GLRender);        // fonction appele lors d'un repaint
-		//glutTimerFunc(100, fnt, 0);         
 		glutMainLoop();
 	}
 	 
@@ -233,7 +264,7 @@ namespace GL
 		Wsize = ScreenSize;
 
 		glutInitWindowPosition(WindowStartPos.x, WindowStartPos.y);
-		glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA);
+		glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA | GLUT_DEPTH);
 		glutInitWindowSize(ScreenSize.x, ScreenSize.y);
 		glutCreateWindow(name.c_str());
 
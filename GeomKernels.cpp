@@ -0,0 +1,204 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+
+#include <cmath>
+#include "GeomKernels.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define KERNELS_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC accepts the AVX2 intrinsics in any function, gcc and clang need the target attribute
+#if defined(KERNELS_X86) && defined(__GNUC__)
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSE2
+#define TARGET_AVX2
+#endif
+
+using namespace std;
+
+/////////////////////////////////////////////////////////////
+//
+//	    Scalar
+//
+/////////////////////////////////////////////////////////////
+
+static inline double dist(const V2& A, const V2& B)
+{
+	double dx = A.x - B.x, dy = A.y - B.y;
+	return sqrt(dx * dx + dy * dy);
+}
+
+static size_t firstSegmentHitScalar(const V2* pts, size_t nbSegments, V2 P, double tol)
+{
+	for (size_t i = 0; i < nbSegments; ++i)
+		if (fabs(dist(P, pts[i]) + dist(P, pts[i + 1]) - dist(pts[i + 1], pts[i])) < tol) return i;
+	return nbSegments;
+}
+
+#ifdef KERNELS_X86
+
+/////////////////////////////////////////////////////////////
+//
+//	    SSE2 : 2 lanes
+//
+/////////////////////////////////////////////////////////////
+
+// |pts[i] - P| for 2 consecutive points, P given as (x, y, x, y)
+TARGET_SSE2 static inline __m128d dist2(const V2* pts, __m128i P)
+{
+	__m128i d = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)pts), P);
+	__m128d a = _mm_cvtepi32_pd(d);                          // x0 y0
+	__m128d b = _mm_cvtepi32_pd(_mm_shuffle_epi32(d, 0xEE)); // x1 y1
+	a = _mm_mul_pd(a, a);
+	b = _mm_mul_pd(b, b);
+	return _mm_sqrt_pd(_mm_add_pd(_mm_unpacklo_pd(a, b), _mm_unpackhi_pd(a, b)));
+}
+
+TARGET_SSE2 static size_t firstSegmentHitSSE2(const V2* pts, size_t nbSegments, V2 P, double tol)
+{
+	__m128i Pv      = _mm_set_epi32(P.y, P.x, P.y, P.x);
+	__m128i zero    = _mm_setzero_si128();
+	__m128d T       = _mm_set1_pd(tol);
+	__m128d absMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+
+	size_t i = 0;
+	for (; i + 2 <= nbSegments; i += 2)
+	{
+		__m128d a = dist2(pts + i, Pv);
+		__m128d b = dist2(pts + i + 1, Pv);
+
+		// |AB| : points i+1, i+2 minus points i, i+1
+		__m128i AB = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(pts + i + 1)), _mm_loadu_si128((const __m128i*)(pts + i)));
+		__m128d L = dist2((const V2*)&AB, zero);
+
+		__m128d d = _mm_and_pd(_mm_sub_pd(_mm_add_pd(a, b), L), absMask);
+		int mask = _mm_movemask_pd(_mm_cmplt_pd(d, T));
+		if (mask) return i + ((mask & 1) ? 0 : 1);
+	}
+	size_t k = firstSegmentHitScalar(pts + i, nbSegments - i, P, tol);
+	return i + k;
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    AVX2 : 4 lanes
+//
+/////////////////////////////////////////////////////////////
+
+// |pts[i] - P| for 4 consecutive points, P given as (x, y) x 4
+TARGET_AVX2 static inline __m256d dist4(const V2* pts, __m256i P)
+{
+	__m256i d = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)pts), P);
+	__m256d a = _mm256_cvtepi32_pd(_mm256_castsi256_si128(d));      // x0 y0 x1 y1
+	__m256d b = _mm256_cvtepi32_pd(_mm256_extracti128_si256(d, 1)); // x2 y2 x3 y3
+	a = _mm256_mul_pd(a, a);
+	b = _mm256_mul_pd(b, b);
+	__m256d s = _mm256_hadd_pd(a, b);                                // 0 2 1 3
+	return _mm256_sqrt_pd(_mm256_permute4x64_pd(s, 0xD8));
+}
+
+TARGET_AVX2 static size_t firstSegmentHitAVX2(const V2* pts, size_t nbSegments, V2 P, double tol)
+{
+	__m256i Pv      = _mm256_set_epi32(P.y, P.x, P.y, P.x, P.y, P.x, P.y, P.x);
+	__m256i zero    = _mm256_setzero_si256();
+	__m256d T       = _mm256_set1_pd(tol);
+	__m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+
+	size_t i = 0;
+	for (; i + 4 <= nbSegments; i += 4)
+	{
+		__m256d a = dist4(pts + i, Pv);
+		__m256d b = dist4(pts + i + 1, Pv);
+
+		__m256i AB = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)(pts + i + 1)), _mm256_loadu_si256((const __m256i*)(pts + i)));
+		__m256d L = dist4((const V2*)&AB, zero);
+
+		__m256d d = _mm256_and_pd(_mm256_sub_pd(_mm256_add_pd(a, b), L), absMask);
+		int mask = _mm256_movemask_pd(_mm256_cmp_pd(d, T, _CMP_LT_OQ));
+		if (mask)
+		{
+			size_t k = 0;
+			while (!(mask & (1 << k))) k++;
+			return i + k;
+		}
+	}
+	size_t k = firstSegmentHitScalar(pts + i, nbSegments - i, P, tol);
+	return i + k;
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Processor features
+//
+/////////////////////////////////////////////////////////////
+
+static bool cpuHas(KernelLevel level)
+{
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+
+	__cpuid(info, 1);
+	bool sse2 = (info[3] >> 26) & 1;
+	if (level == KernelLevel::SSE2) return sse2;
+
+	// AVX2 also needs the OS to save the ymm registers
+	bool osxsave = (info[2] >> 27) & 1, avx = (info[2] >> 28) & 1;
+	if (!osxsave || !avx || maxLeaf < 7) return false;
+	if ((_xgetbv(0) & 6) != 6) return false;
+	__cpuidex(info, 7, 0);
+	return (info[1] >> 5) & 1;
+#else
+	__builtin_cpu_init();
+	if (level == KernelLevel::SSE2) return __builtin_cpu_supports("sse2");
+	return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif // KERNELS_X86
+
+/////////////////////////////////////////////////////////////
+//
+//	    Selection
+//
+/////////////////////////////////////////////////////////////
+
+static const GeomKernels Kernels[] =
+{
+	{ KernelLevel::Scalar, "scalar", firstSegmentHitScalar },
+#ifdef KERNELS_X86
+	{ KernelLevel::SSE2,   "sse2",   firstSegmentHitSSE2 },
+	{ KernelLevel::AVX2,   "avx2",   firstSegmentHitAVX2 },
+#endif
+};
+
+const GeomKernels* geomKernels(KernelLevel level)
+{
+	for (const GeomKernels& K : Kernels)
+		if (K.level == level)
+		{
+#ifdef KERNELS_X86
+			if (level != KernelLevel::Scalar && !cpuHas(level)) return nullptr;
+#endif
+			return &K;
+		}
+	return nullptr;
+}
+
+const GeomKernels& geomKernels()
+{
+	static const GeomKernels* best = []
+	{
+		for (int l = (int)KernelLevel::Count - 1; l > 0; --l)
+			if (const GeomKernels* K = geomKernels((KernelLevel)l)) return K;
+		return &Kernels[0];
+	}();
+	return *best;
+}
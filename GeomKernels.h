@@ -0,0 +1,30 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <cstddef>
+#include "V2.h"
+
+// one point tested against many segments at once
+//
+// scalar, SSE2 (2 doubles) and AVX2 (4 doubles) versions, the best one supported by the
+// processor is chosen at the first call of geomKernels(). All the versions do the same
+// double operations as the scalar code (sqrt is exact in SSE2/AVX2), so they give the
+// same answers bit for bit.
+
+enum class KernelLevel { Scalar, SSE2, AVX2, Count };
+
+struct GeomKernels
+{
+	KernelLevel level;
+	const char* name;
+
+	// first segment [pts[i], pts[i+1]], i < nbSegments, with | |PA| + |PB| - |AB| | < tol
+	// (P inside the ellipse of foci A and B, see ObjPolyLine::hit), nbSegments if none
+	size_t (*firstSegmentHit)(const V2* pts, size_t nbSegments, V2 P, double tol);
+};
+
+// best version for this processor
+const GeomKernels& geomKernels();
+
+// a given version, nullptr if the processor does not support it (benchmarks)
+const GeomKernels* geomKernels(KernelLevel level);
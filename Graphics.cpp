@@ -1,10 +1,12 @@
 #include "Graphics.h"
 #include "GlutImport.h"
+#include "CircleTable.h"
+#include "StrokeFont.h"
 #include <algorithm>
 
 
 extern V2 Wsize;
-V2   Graphics::getWindowSize()
+V2   GLGraphics::getWindowSize()
 {
 	return Wsize;
 }
@@ -14,64 +16,157 @@ V2   Graphics::getWindowSize()
 
 /////////////////////////////////////////////////////////////
 //
-//	    RectWithTexture
+//	    State cache
 //
 /////////////////////////////////////////////////////////////
 
-int GetTextureIdFromPNG(std::string PNGFileName);
-int GetTextureIdFromJPG(std::string JPGFileName);
+// last value sent to GL for each state used by the drawings : a change is only sent
+// when it differs. Each drawing sets all the states it depends on and resets none.
+// The GL state is global, so is the cache : one for all the GLGraphics objects.
+
+namespace
+{
+	const GLenum Unknown = ~0u;
+
+	struct StateCache
+	{
+		int     texture2D, blend, depthTest, scissorTest;   // 0, 1, -1 : unknown
+		GLenum  polygonMode, blendSrc, blendDst, depthFunc;
+		GLfloat lineWidth;
+		GLuint  texture;
+
+		long long issued = 0, skipped = 0;
+
+		StateCache() { invalidate(); }
+
+		void invalidate()
+		{
+			texture2D = blend = depthTest = scissorTest = -1;
+			polygonMode = blendSrc = blendDst = depthFunc = Unknown;
+			lineWidth = -1;
+			texture = Unknown;
+		}
+
+		// true if the new value must be sent
+		template <class T>
+		bool change(T& current, T value)
+		{
+			if (current == value) { skipped++; return false; }
+			current = value;
+			issued++;
+			return true;
+		}
+
+		void enable(int& current, GLenum cap, bool on)
+		{
+			if (!change(current, (int)on)) return;
+			if (on) glEnable(cap);
+			else    glDisable(cap);
+		}
+	};
+
+	StateCache State;
+}
+
+static void SetTexture2D(bool on)   { State.enable(State.texture2D, GL_TEXTURE_2D, on); }
+static void SetBlend(bool on)       { State.enable(State.blend, GL_BLEND, on); }
+static void SetDepthTest(bool on)   { State.enable(State.depthTest, GL_DEPTH_TEST, on); }
+static void SetScissorTest(bool on) { State.enable(State.scissorTest, GL_SCISSOR_TEST, on); }
 
-string GetExtension(string filename)
+static void SetPolygonMode(GLenum mode)
 {
-	return filename.substr(filename.size() - 4);
+	if (State.change(State.polygonMode, mode)) glPolygonMode(GL_FRONT_AND_BACK, mode);
 }
 
-#include <cctype>
-static std::string ToLower(std::string s) {
-	std::transform(s.begin(), s.end(), s.begin(),
-		[](unsigned char c) { return (char)std::tolower(c); });
-	return s;
+static void SetLineWidth(GLfloat width)
+{
+	if (State.change(State.lineWidth, width)) glLineWidth(width);
 }
-static std::string GetExtSafe(const std::string& f) {
-	auto s = ToLower(f);
-	if (s.size() >= 5 && s.rfind(".jpeg") == s.size() - 5) return ".jpeg";
-	if (s.size() >= 4) return s.substr(s.size() - 4); // .jpg / .png
-	return "";
+
+static void SetDepthFunc(GLenum func)
+{
+	if (State.change(State.depthFunc, func)) glDepthFunc(func);
 }
 
-void Graphics::drawRectWithTexture(std::string JPGPNGFileName, V2 pos, V2 size, float angleDeg)
+static void BindTexture(GLuint texture)
 {
-	// --- choix texture
-	int idTexture = 0;
-	auto ext = GetExtSafe(JPGPNGFileName);
+	if (State.change(State.texture, texture)) glBindTexture(GL_TEXTURE_2D, texture);
+}
 
-	if (ext == ".jpg" || ext == ".jpeg")      idTexture = GetTextureIdFromJPG(JPGPNGFileName);
-	else if (ext == ".png")                   idTexture = GetTextureIdFromPNG(JPGPNGFileName);
-	else                                      idTexture = GetTextureIdFromPNG("error.png");
+// usual transparency, counted as one change
+static void SetAlphaBlendFunc()
+{
+	if (State.blendSrc == GL_SRC_ALPHA && State.blendDst == GL_ONE_MINUS_SRC_ALPHA) { State.skipped++; return; }
+	State.blendSrc = GL_SRC_ALPHA;
+	State.blendDst = GL_ONE_MINUS_SRC_ALPHA;
+	State.issued++;
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+// flat drawings : no texture, no depth test, alpha blending on demand
+static void SetFlatState(bool blend)
+{
+	SetTexture2D(false);
+	SetDepthTest(false);
+	SetBlend(blend);
+	if (blend) SetAlphaBlendFunc();
+}
+
+void GLGraphics::invalidateState()
+{
+	State.invalidate();
+}
+
+void GLGraphics::getStateChanges(long long& issued, long long& skipped)
+{
+	issued = State.issued;
+	skipped = State.skipped;
+}
+
+
+/////////////////////////////////////////////////////////////
+//
+//	    RectWithTexture
+//
+/////////////////////////////////////////////////////////////
+
+// texture cache, in texture.cpp
+int  GetTextureId(const std::string& filename);
+void SetTextureMemoryBudget(size_t bytes);
+
+void GLGraphics::setTextureMemoryBudget(size_t bytes)
+{
+	SetTextureMemoryBudget(bytes);
+}
+
+void GLGraphics::drawRectWithTexture(std::string JPGPNGFileName, V2 pos, V2 size, float angleDeg)
+{
+	// --- choix texture (PNG ou JPG, decodee une seule fois)
+	int idTexture = GetTextureId(JPGPNGFileName);
 
 	// --- tat rendu
 	
-	glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+	SetPolygonMode(GL_FILL);
+	SetDepthTest(false);
 
 	#define GL_CLAMP_TO_EDGE 0x812F
 
 	if (idTexture > 0)
 	{
-		glEnable(GL_TEXTURE_2D);
-		glEnable(GL_BLEND);
-		glBindTexture(GL_TEXTURE_2D, (GLuint)idTexture);
+		SetTexture2D(true);
+		SetBlend(true);
+		SetAlphaBlendFunc();
+		BindTexture((GLuint)idTexture);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 		// Facultatif mais utile contre les franges :
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 		glColor4ub(255, 255, 255, 255);          // ne pas assombrir la texture
 	}
 	else 
 	{
-		glDisable(GL_BLEND);
-		glDisable(GL_TEXTURE_2D);
+		SetFlatState(false);
 		glColor4ub(255, 0, 255, 255);            // magenta error
 	}
 
@@ -98,12 +193,6 @@ void Graphics::drawRectWithTexture(std::string JPGPNGFileName, V2 pos, V2 size,
 	glEnd();
 
 	glPopMatrix();
-
-	// Nettoyage lger (optionnel)
-	glDisable(GL_TEXTURE_2D);
-	glDisable(GL_BLEND);
-	glColor4ub(255, 255, 255, 255);
-	glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 }
 
 
@@ -113,14 +202,107 @@ void Graphics::drawRectWithTexture(std::string JPGPNGFileName, V2 pos, V2 size,
 //
 /////////////////////////////////////////////////////////////
 
-void Graphics::clearWindow(Color c) 
+void GLGraphics::clearWindow(Color c) 
 {
 	glClearColor(c.R, c.G, c.B, c.A);
-	glClear(GL_COLOR_BUFFER_BIT);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Frame cache
+//
+/////////////////////////////////////////////////////////////
+
+// power of two textures, larger than the window, one per layer
+static GLuint FrameTexture[(int)FrameLayer::Count] = {};
+static int    FrameTexW = 0, FrameTexH = 0;
+
+static int NextPowerOf2(int v)
+{
+	int p = 1;
+	while (p < v) p *= 2;
+	return p;
 }
 
-void Graphics::setPixel(V2 P, Color c) 
+void GLGraphics::saveFrame(V2 P, V2 size, FrameLayer layer)
 {
+	V2 W = getWindowSize();
+	GLuint& texture = FrameTexture[(int)layer];
+
+	if (texture == 0)
+	{
+		FrameTexW = NextPowerOf2(W.x);
+		FrameTexH = NextPowerOf2(W.y);
+		glGenTextures(1, &texture);
+		BindTexture(texture);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, FrameTexW, FrameTexH, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	}
+
+	// clip to the window
+	int x0 = max(0, P.x), y0 = max(0, P.y);
+	int x1 = min(W.x, P.x + size.x), y1 = min(W.y, P.y + size.y);
+	if (x1 <= x0 || y1 <= y0) return;
+
+	BindTexture(texture);
+	glCopyTexSubImage2D(GL_TEXTURE_2D, 0, x0, y0, x0, y0, x1 - x0, y1 - y0);
+}
+
+void GLGraphics::restoreFrame(FrameLayer layer)
+{
+	GLuint texture = FrameTexture[(int)layer];
+	if (texture == 0) return;
+
+	V2 W = getWindowSize();
+	float u = (float)W.x / FrameTexW;
+	float v = (float)W.y / FrameTexH;
+
+	SetBlend(false);
+	SetDepthTest(false);
+	SetPolygonMode(GL_FILL);
+	SetTexture2D(true);
+	BindTexture(texture);
+	glColor4ub(255, 255, 255, 255);
+
+	glBegin(GL_QUADS);
+	glTexCoord2f(0, 0); glVertex2i(0, 0);
+	glTexCoord2f(u, 0); glVertex2i(W.x, 0);
+	glTexCoord2f(u, v); glVertex2i(W.x, W.y);
+	glTexCoord2f(0, v); glVertex2i(0, W.y);
+	glEnd();
+}
+
+bool GLGraphics::hasFrame(FrameLayer layer)
+{
+	return FrameTexture[(int)layer] != 0;
+}
+
+void GLGraphics::setClip(V2 P, V2 size)
+{
+	SetScissorTest(true);
+	glScissor(P.x, P.y, max(0, size.x), max(0, size.y));
+	clipOn_ = true;
+	clipP_ = P;
+	clipSize_ = size;
+}
+
+void GLGraphics::resetClip()
+{
+	SetScissorTest(false);
+	clipOn_ = false;
+}
+
+void GLGraphics::getClip(V2& P, V2& size)
+{
+	if (clipOn_) { P = clipP_; size = clipSize_; }
+	else { P = V2(0, 0); size = getWindowSize(); }
+}
+
+void GLGraphics::setPixel(V2 P, Color c) 
+{
+	SetFlatState(false);
 	glColor4d(c.R, c.G, c.B, c.A);
 	glBegin(GL_POINTS);
 	glVertex2i(P.x, P.y); //Set pixel coordinates 
@@ -129,74 +311,97 @@ void Graphics::setPixel(V2 P, Color c)
 }
 
 
-void Graphics::drawRectangle(V2 P1, V2 Size, Color c, bool fill, int thickness) 
+void GLGraphics::drawRectangle(V2 P1, V2 Size, Color c, bool fill, int thickness) 
 {
-	glDisable(GL_TEXTURE_2D);                 // pas de texture
-
-	glLineWidth(thickness);
+	SetFlatState(false);                      // pas de texture
 	glColor4d(c.R, c.G, c.B, c.A);
-	glDisable(GL_TEXTURE_2D);
 
-	if (fill)   glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-	else    	glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+	if (fill)   SetPolygonMode(GL_FILL);
+	else      { SetPolygonMode(GL_LINE); SetLineWidth(thickness); }
 	glRecti((int)P1.x, (int)P1.y, (int)(P1.x + Size.x), (int)(P1.y + Size.y));
 
 }
 
-void Graphics::drawCircle(V2 C, float r, Color c, bool fill, int thickness)
+// vertices sent directly from the circle table, the last one closes the loop
+void GLGraphics::drawCircle(V2 C, float r, Color c, bool fill, int thickness)
 {
-	glLineWidth(thickness);
-
-	vector<V2> LPoints;
-
-	int lineAmount = r / 4; //  nb of triangles used to draw circle
-	if (lineAmount < 20) lineAmount = 20;
-
-	const double PI = 3.14159265358;
-
-	//GLfloat radius = 0.8f; //radius
-	double step = 2 * PI / lineAmount;
+	SetFlatState(false);
+	glColor4d(c.R, c.G, c.B, c.A);
 
-	for (int i = 0; i <= lineAmount; i++)
-		LPoints.push_back(V2(C.x + r * cos(i * step), C.y + r * sin(i * step)));
+	if (fill)   SetPolygonMode(GL_FILL);
+	else        SetLineWidth(thickness);
 
-	Graphics::drawPolygon(LPoints, c, fill);
+	glBegin(fill ? GL_POLYGON : GL_LINE_STRIP);
+	circlePoints((float)C.x, (float)C.y, r, circleSides(r), [](float x, float y) { glVertex2f(x, y); });
+	glEnd();
 }
 
-void Graphics::drawLine(V2 P1, V2 P2, Color c, int thickness)
+void GLGraphics::drawLine(V2 P1, V2 P2, Color c, int thickness)
 {
-	glDisable(GL_TEXTURE_2D);
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-	glLineWidth((GLfloat)thickness);
+	SetFlatState(true);
+	SetLineWidth(thickness);
 	glColor4d(c.R, c.G, c.B, c.A);
 
 	glBegin(GL_LINES);
 	glVertex2f(P1.x, P1.y);
 	glVertex2f(P2.x, P2.y);
 	glEnd();
-
-	glLineWidth(1.0f);
-	glDisable(GL_BLEND);
 }
 
-void Graphics::drawPolygon(vector<V2>& PointList, Color c, bool fill, int thickness)
+void GLGraphics::drawPolygon(vector<V2>& PointList, Color c, bool fill, int thickness)
 {
-	glDisable(GL_TEXTURE_2D);
+	SetFlatState(false);
 	glColor4d(c.R, c.G, c.B, c.A);
-	glLineWidth(thickness);
 
-	if (fill) glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-	else glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-	 
+	if (fill)   SetPolygonMode(GL_FILL);
+	else      { SetPolygonMode(GL_LINE); SetLineWidth(thickness); }
 
 	glBegin(GL_POLYGON);
 	for (V2 P : PointList)
 		glVertex2f(P.x, P.y);
 	glEnd();
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Batches
+//
+/////////////////////////////////////////////////////////////
+
+// vertex arrays with a color per vertex, the whole list in a single draw call
+static void DrawArrays(const vector<GVertex>& V, GLenum mode)
+{
+	if (V.empty()) return;
 
-	glPolygonMode(GL_FRONT_AND_BACK, GL_FILL); // reset dhygine
+	SetTexture2D(false);
+	SetPolygonMode(GL_FILL);
+	SetDepthTest(true);
+	SetDepthFunc(GL_LEQUAL);
+
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glVertexPointer(3, GL_FLOAT, sizeof(GVertex), &V[0].x);
+	glColorPointer(4, GL_FLOAT, sizeof(GVertex), &V[0].R);
+
+	glDrawArrays(mode, 0, (GLsizei)V.size());
+
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+void GLGraphics::drawTriangles(const vector<GVertex>& V)
+{
+	SetBlend(false);
+	DrawArrays(V, GL_TRIANGLES);
+}
+
+void GLGraphics::drawLines(const vector<GVertex>& V, int thickness)
+{
+	SetBlend(true);
+	SetAlphaBlendFunc();
+	SetLineWidth(thickness);
+
+	DrawArrays(V, GL_LINES);
 }
 
 /////////////////////////////////////////////////////////////
@@ -206,38 +411,36 @@ void Graphics::drawPolygon(vector<V2>& PointList, Color c, bool fill, int thickn
 /////////////////////////////////////////////////////////////
 
 
+// the segments of the whole string (see StrokeFont.h) in one draw call
 void DrawString(V2 pos, string text, float fontSize, float thickness, Color c, bool FontMono)
 {
+	const vector<float>& xy = strokeTextSegments(FontMono ? StrokeFontId::MonoRoman : StrokeFontId::Roman, text, fontSize);
+	if (xy.empty()) return;
+
+	SetFlatState(false);
 	glColor4f(c.R, c.G, c.B, c.A);
 
 
 	// EPAISSEUR de la font
-	glLineWidth(thickness);
+	SetLineWidth(thickness);
 
 	glPushMatrix();
 	glTranslatef(pos.x, pos.y, 0);
-	glScalef(1 / 152.38, 1 / 152.38, 1 / 152.38);
-	glScalef(fontSize, fontSize, fontSize);
-	const char* cc = text.c_str();
-	for (char* p = (char*)cc; *p; p++)
-	{
-		if (FontMono) glutStrokeCharacter(GLUT_STROKE_MONO_ROMAN, *p);
-		else          glutStrokeCharacter(GLUT_STROKE_ROMAN, *p);
-	}
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glVertexPointer(2, GL_FLOAT, 0, xy.data());
+	glDrawArrays(GL_LINES, 0, (GLsizei)(xy.size() / 2));
+	glDisableClientState(GL_VERTEX_ARRAY);
 	glPopMatrix();
-	glLineWidth(1);
 }
 
 
-void Graphics::drawStringFontMono(V2 pos, string text, float fontSize, float thickness, Color c) 
+void GLGraphics::drawStringFontMono(V2 pos, string text, float fontSize, float thickness, Color c) 
 {
-	glDisable(GL_TEXTURE_2D);
 	DrawString(pos, text, fontSize, thickness, c, true);
 }
 
-void Graphics::drawStringFontRoman(V2 pos, string text, float fontSize, float thickness, Color c) 
+void GLGraphics::drawStringFontRoman(V2 pos, string text, float fontSize, float thickness, Color c) 
 {
-	glDisable(GL_TEXTURE_2D);
 	DrawString(pos, text, fontSize, thickness, c, false);
 }
 
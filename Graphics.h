@@ -7,33 +7,110 @@
 
 using namespace std;
 
+// vertex of a batched draw call (see SceneRenderer)
+// z increases with the drawing order : a higher z is drawn in front
+struct GVertex
+{
+	float x, y, z;
+	float R, G, B, A;
+
+	GVertex() : x(0), y(0), z(0), R(0), G(0), B(0), A(0) {}
+	GVertex(V2 P, Color c) : x((float)P.x), y((float)P.y), z(0), R(c.R), G(c.G), B(c.B), A(c.A) {}
+	GVertex(float x, float y, Color c) : x(x), y(y), z(0), R(c.R), G(c.G), B(c.B), A(c.A) {}
+};
+
+// copies of the window kept by the frame cache (see drawApp)
+// Frame : everything but the cursor and the tool preview, Scene : background and objects only
+enum class FrameLayer { Frame, Scene, Count };
+
+// drawing interface used by the application
+// GLGraphics draws in the window, SoftGraphics in a memory buffer (no display needed)
+
 class Graphics
 {
 
 public:
 
+	virtual ~Graphics() {}
+
 	// Window Management
 	static void initMainWindow(string name, V2 ScreenSize, V2 WindowStartPos);
 	
-	V2   getWindowSize();
-	void clearWindow(Color c);
+	virtual V2   getWindowSize() = 0;
+	virtual void clearWindow(Color c) = 0;
+
+	// Frame cache : copies of the window, so that only the damaged regions are drawn again
+	virtual void saveFrame(V2 P, V2 size, FrameLayer layer = FrameLayer::Frame) = 0;   // copy this region of the window into the cache
+	virtual void restoreFrame(FrameLayer layer = FrameLayer::Frame) = 0;             // whole window from the cache
+	virtual bool hasFrame(FrameLayer layer) = 0;                                     // saved at least once
+	virtual void setClip(V2 P, V2 size) = 0;     // next drawings limited to this region (clearWindow too)
+	virtual void resetClip() = 0;
+	virtual void getClip(V2& P, V2& size) = 0;   // region drawn by the next drawings, the window if no clip
 	
 
 	// Font
-	void drawStringFontMono(V2 pos, string text, float fontSize = 20, float thickness = 3, Color c = Color::Black);
-	void drawStringFontRoman(V2 pos, string text, float fontSize = 20, float thickness = 3, Color c = Color::Black);
+	virtual void drawStringFontMono(V2 pos, string text, float fontSize = 20, float thickness = 3, Color c = Color::Black) = 0;
+	virtual void drawStringFontRoman(V2 pos, string text, float fontSize = 20, float thickness = 3, Color c = Color::Black) = 0;
 
 
 	// draw a sprite associated to a filename
 	// use angleDef for rotation
-	void drawRectWithTexture(std::string filename, V2 pos, V2 size, float angleDeg = 0);
+	virtual void drawRectWithTexture(std::string filename, V2 pos, V2 size, float angleDeg = 0) = 0;
 
 	// Draw Geometry
-	void setPixel(V2 P, Color c);
-	void drawLine(V2 P1, V2 P2, Color c, int thickness = 1);
-	void drawPolygon(vector<V2>& PointList, Color c, bool fill = false, int thickness = 1);
-	void drawRectangle(V2 P1, V2 Size, Color c, bool fill = false, int thickness = 1);
-	void drawCircle(V2 C, float r, Color c, bool fill = false, int thickness = 1);
+	virtual void setPixel(V2 P, Color c) = 0;
+	virtual void drawLine(V2 P1, V2 P2, Color c, int thickness = 1) = 0;
+	virtual void drawPolygon(vector<V2>& PointList, Color c, bool fill = false, int thickness = 1) = 0;
+	virtual void drawRectangle(V2 P1, V2 Size, Color c, bool fill = false, int thickness = 1) = 0;
+	virtual void drawCircle(V2 C, float r, Color c, bool fill = false, int thickness = 1) = 0;   // see CircleTable.h
+
+	// Batched geometry, one draw call per list, depth tested on z
+	virtual void drawTriangles(const vector<GVertex>& V) = 0;
+	virtual void drawLines(const vector<GVertex>& V, int thickness = 1) = 0;
+
+	// render state changes sent to the GPU and avoided since the start, 0 without GPU
+	virtual void getStateChanges(long long& issued, long long& skipped) { issued = skipped = 0; }
+};
+
+
+// OpenGL / GLUT implementation, draws in the main window
+
+class GLGraphics : public Graphics
+{
+	bool clipOn_ = false;
+	V2   clipP_, clipSize_;
+
+public:
+
+	V2   getWindowSize() override;
+	void clearWindow(Color c) override;
+
+	void saveFrame(V2 P, V2 size, FrameLayer layer = FrameLayer::Frame) override;
+	void restoreFrame(FrameLayer layer = FrameLayer::Frame) override;
+	bool hasFrame(FrameLayer layer) override;
+	void setClip(V2 P, V2 size) override;
+	void resetClip() override;
+	void getClip(V2& P, V2& size) override;
+
+	void drawStringFontMono(V2 pos, string text, float fontSize, float thickness, Color c) override;
+	void drawStringFontRoman(V2 pos, string text, float fontSize, float thickness, Color c) override;
+
+	void drawRectWithTexture(std::string filename, V2 pos, V2 size, float angleDeg) override;
+
+	// GPU memory allowed for the textures, the least recently used are released beyond it
+	static void setTextureMemoryBudget(size_t bytes);
+
+	// the GL states are cached : to call after changing them outside GLGraphics
+	static void invalidateState();
+
+	void setPixel(V2 P, Color c) override;
+	void drawLine(V2 P1, V2 P2, Color c, int thickness) override;
+	void drawPolygon(vector<V2>& PointList, Color c, bool fill, int thickness) override;
+	void drawRectangle(V2 P1, V2 Size, Color c, bool fill, int thickness) override;
+	void drawCircle(V2 C, float r, Color c, bool fill, int thickness) override;
 
+	void drawTriangles(const vector<GVertex>& V) override;
+	void drawLines(const vector<GVertex>& V, int thickness) override;
 
-};
\ No newline at end of file
+	void getStateChanges(long long& issued, long long& skipped) override;
+};
@@ -0,0 +1,96 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+
+#include <algorithm>
+#include "IdBuffer.h"
+
+void IdBuffer::resize(V2 size)
+{
+	if (size.x == W_ && size.y == H_) return;
+	W_ = max(0, size.x);
+	H_ = max(0, size.y);
+	ids_.assign((size_t)W_ * H_, 0);
+	invalidateAll();
+}
+
+void IdBuffer::invalidate(V2 P, V2 size)
+{
+	if (full_) return;
+	dirty_.push_back({ P, size });
+
+	// many small regions : their union
+	if (dirty_.size() > 16)
+	{
+		V2 A = dirty_[0].first, B = A;
+		for (auto& R : dirty_)
+		{
+			A = V2(min(A.x, R.first.x), min(A.y, R.first.y));
+			B = V2(max(B.x, R.first.x + R.second.x), max(B.y, R.first.y + R.second.y));
+		}
+		dirty_ = { { A, B - A } };
+	}
+}
+
+void IdBuffer::drawObject(const SceneStore& S, uint32_t s, const RasterClip& clip)
+{
+	fill_.clear();
+	lines_.clear();
+	SceneStore::Tessellator T = { fill_, lines_ };
+	S.visit(s, T);
+
+	uint32_t id = s + 1;
+	auto plot = [&](int x, int y) { ids_[(size_t)y * W_ + x] = id; };
+
+	X_.resize(3);
+	Y_.resize(3);
+	for (size_t i = 0; i + 2 < fill_.size(); i += 3)
+	{
+		for (int k = 0; k < 3; ++k) { X_[k] = fill_[i + k].x; Y_[k] = fill_[i + k].y; }
+		rasterPolygon(X_.data(), Y_.data(), 3, clip, cross_, plot);
+	}
+
+	int thickness = S.shapes(S.type(s)).attr[S.row(s)].thickness_ + 2 * PickMargin;
+	for (size_t i = 0; i + 1 < lines_.size(); i += 2)
+		rasterLine(lines_[i].x, lines_[i].y, lines_[i + 1].x, lines_[i + 1].y, thickness, clip, cross_, plot);
+
+	lastRedrawn_++;
+}
+
+// clears the region then draws the objects that cross it, from back to front
+void IdBuffer::redraw(const SceneStore& S, const SpatialIndex& index, V2 P, V2 size)
+{
+	RasterClip clip = { max(0, P.x), max(0, P.y), min(W_, P.x + size.x + 1), min(H_, P.y + size.y + 1) };
+	if (clip.x0 >= clip.x1 || clip.y0 >= clip.y1) return;
+
+	for (int y = clip.y0; y < clip.y1; ++y)
+		fill(ids_.begin() + (size_t)y * W_ + clip.x0, ids_.begin() + (size_t)y * W_ + clip.x1, 0);
+
+	slots_.clear();
+	index.queryRegion(V2(clip.x0, clip.y0), V2(clip.x1 - clip.x0, clip.y1 - clip.y0), slots_);
+	sort(slots_.begin(), slots_.end(), [&S](uint32_t a, uint32_t b) { return S.z(a) < S.z(b); });
+
+	for (uint32_t s : slots_)
+		drawObject(S, s, clip);
+}
+
+void IdBuffer::refresh(const SceneStore& S, const SpatialIndex& index)
+{
+	lastRedrawn_ = 0;
+
+	if (full_)
+	{
+		fill(ids_.begin(), ids_.end(), 0);
+		RasterClip clip = { 0, 0, W_, H_ };
+		for (auto& e : S.order())
+		{
+			const SceneStore::Box& b = S.box(e.second);
+			if (b.x1 < 0 || b.y1 < 0 || b.x0 >= W_ || b.y0 >= H_) continue;
+			drawObject(S, e.second, clip);
+		}
+	}
+	else
+		for (auto& R : dirty_)
+			redraw(S, index, R.first, R.second);
+
+	full_ = false;
+	dirty_.clear();
+}
@@ -0,0 +1,69 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "V2.h"
+#include "Graphics.h"
+#include "Raster.h"
+#include "SceneStore.h"
+#include "SpatialIndex.h"
+
+using namespace std;
+
+// object ID raster : for each pixel of the window, the store slot of the topmost object drawn there
+//
+// the objects are rasterized from their tessellation (fill and border thickness) with the
+// scan conversion of SoftGraphics, the lines grown by PickMargin pixels on each side so
+// that the thin ones stay easy to grab. Model marks the regions modified by each edit and
+// they are drawn again at the next lookup only : a pick is one read in the buffer,
+// whatever the size of the scene or the complexity of the shapes.
+
+class IdBuffer
+{
+public:
+	static const uint32_t None = UINT32_MAX;
+	static const int PickMargin = 2;
+
+private:
+	int W_ = 0, H_ = 0;
+	vector<uint32_t> ids_;            // slot + 1, 0 = no object, first row = bottom of the window
+	bool full_ = true;                // everything must be drawn again
+	vector< pair<V2, V2> > dirty_;    // else these regions (position, size)
+	int lastRedrawn_ = 0;
+
+	// scratch buffers, kept between the refreshes
+	vector<uint32_t> slots_;
+	vector<GVertex>  fill_, lines_;
+	vector<float>    X_, Y_, cross_;
+
+	void drawObject(const SceneStore& S, uint32_t s, const RasterClip& clip);
+	void redraw(const SceneStore& S, const SpatialIndex& index, V2 P, V2 size);
+
+public:
+
+	V2 size() const { return V2(W_, H_); }
+
+	// the whole buffer is drawn again at the next refresh
+	void resize(V2 size);
+
+	void invalidate(V2 P, V2 size);
+	void invalidateAll() { full_ = true; dirty_.clear(); }
+
+	bool needsRefresh() const { return full_ || !dirty_.empty(); }
+
+	// draws the invalid regions, index : boxes of the store slots (see Model)
+	void refresh(const SceneStore& S, const SpatialIndex& index);
+
+	bool covers(const V2& p) const { return p.x >= 0 && p.x < W_ && p.y >= 0 && p.y < H_; }
+
+	// slot of the object seen at p, None if none, after a refresh
+	uint32_t at(const V2& p) const
+	{
+		if (!covers(p)) return None;
+		return ids_[(size_t)p.y * W_ + p.x] - 1;
+	}
+
+	// objects rasterized by the last refresh
+	int lastRedrawn() const { return lastRedrawn_; }
+};
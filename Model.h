@@ -5,19 +5,212 @@
 #include "ObjGeom.h"
 #include "V2.h"
 #include "ObjAttr.h"
+#include "SpatialIndex.h"
+#include "SceneStore.h"
+#include "ControlPointIndex.h"
+#include "IdBuffer.h"
 #include <vector>
+#include <map>
 #include <memory>
+#include <iterator>
+#include <algorithm>
 using namespace std;
 
 // declaration used to avoid cyclic dependency
-class Tool; 
+class Tool;
 class Button;
 class Model;
 void initApp(Model& Data);
 
 
+// regions of the window modified since the last frame, only those are drawn again (see drawApp)
+struct Damage
+{
+	bool full = true;             // everything must be drawn
+	vector< pair<V2, V2> > rects; // position, size
+
+	void add(V2 P, V2 size) { if (!full) rects.push_back({ P, size }); }
+	void addAll()           { full = true; rects.clear(); }
+	void clear()            { full = false; rects.clear(); }
+};
+
+
+// scene objects sorted by zOrder_, in a balanced tree : finding, removing and moving
+// an object to the front or to the back cost O(log n). The z values are sparse
+// integers (new ones are taken past the current top or bottom), so no renumbering
+// is needed. Iterated from back to front, like the drawing.
+class ObjectList
+{
+	typedef multimap< long long, shared_ptr<ObjGeom> > Map;   // equal z are tolerated
+	Map byZ_;
+
+	friend class Model;
+
+public:
+
+	class const_iterator
+	{
+		Map::const_iterator it_;
+	public:
+		typedef bidirectional_iterator_tag iterator_category;
+		typedef shared_ptr<ObjGeom>        value_type;
+		typedef ptrdiff_t                  difference_type;
+		typedef const shared_ptr<ObjGeom>* pointer;
+		typedef const shared_ptr<ObjGeom>& reference;
+
+		const_iterator() {}
+		const_iterator(Map::const_iterator it) : it_(it) {}
+
+		reference operator*()  const { return it_->second; }
+		pointer   operator->() const { return &it_->second; }
+		const_iterator& operator++() { ++it_; return *this; }
+		const_iterator& operator--() { --it_; return *this; }
+		const_iterator  operator++(int) { const_iterator t = *this; ++it_; return t; }
+		const_iterator  operator--(int) { const_iterator t = *this; --it_; return t; }
+		bool operator==(const const_iterator& o) const { return it_ == o.it_; }
+		bool operator!=(const const_iterator& o) const { return it_ != o.it_; }
+	};
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	const_iterator begin() const { return const_iterator(byZ_.begin()); }
+	const_iterator end()   const { return const_iterator(byZ_.end()); }
+
+	// from front to back
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	const_reverse_iterator rend()   const { return const_reverse_iterator(begin()); }
+
+	size_t size()  const { return byZ_.size(); }
+	bool   empty() const { return byZ_.empty(); }
+
+	const shared_ptr<ObjGeom>& front() const { return byZ_.begin()->second; }
+	const shared_ptr<ObjGeom>& back()  const { return byZ_.rbegin()->second; }
+
+	vector< shared_ptr<ObjGeom> > toVector() const
+	{
+		vector< shared_ptr<ObjGeom> > v;
+		v.reserve(byZ_.size());
+		for (auto& e : byZ_) v.push_back(e.second);
+		return v;
+	}
+};
+
+
 class Model
 {
+	SpatialIndex index_;   // by store slot
+	SceneStore   store_;
+	ControlPointIndex points_;   // control points, by store slot and point index
+	vector<V2>   oldPoints_, newPoints_;
+	mutable IdBuffer ids_;       // drawn objects by pixel, refreshed at the lookups
+	long long    topZ_    = 0;
+	long long    bottomZ_ = 0;
+	unsigned long long revision_ = 0;   // changed by every modification of the scene
+
+	// LObjets is keyed by zOrder_
+	ObjectList::Map::iterator find(const ObjGeom* obj)
+	{
+		auto range = LObjets.byZ_.equal_range(obj->zOrder_);
+		for (auto it = range.first; it != range.second; ++it)
+			if (it->second.get() == obj) return it;
+		return LObjets.byZ_.end();
+	}
+
+	// the indexed box covers the pick area and the drawn area (border, edition handles)
+	// so that it can also be used as the damaged region of the object
+	static SceneStore::Box indexBox(const ObjGeom* obj)
+	{
+		V2 P, size, B, Bsize;
+		obj->getPickBox(P, size);
+		obj->getBoundingBox(B, Bsize);
+		int pad = obj->drawInfo_.thickness_ + 8;
+		B = B - V2(pad, pad);
+		Bsize = Bsize + V2(2 * pad, 2 * pad);
+
+		V2 Q(min(P.x, B.x), min(P.y, B.y));
+		V2 R(max(P.x + size.x, B.x + Bsize.x), max(P.y + size.y, B.y + Bsize.y));
+		return { Q.x, Q.y, R.x, R.y };
+	}
+
+	// the object enters the store if it is not there yet, else its row is refreshed
+	void indexObject(ObjGeom* obj)
+	{
+		SceneStore::Box box = indexBox(obj);
+
+		oldPoints_.clear();
+		if (store_.valid(obj->handle_))
+		{
+			store_.getControlPoints(obj->handle_.index, oldPoints_);
+			store_.update(obj->handle_, box);
+		}
+		else obj->handle_ = store_.add(obj, box);
+		if (obj->handle_.isNull()) return;
+
+		indexPoints(obj->handle_.index);
+		indexRegion(obj->handle_.index, box);
+	}
+
+	void indexRegion(uint32_t s, const SceneStore::Box& box)
+	{
+		V2 Q(box.x0, box.y0), size(box.x1 - box.x0, box.y1 - box.y0);
+		index_.insert(s, Q, size);
+		damageRegion(Q, size);
+	}
+
+	// only the control points that moved since the last update (in oldPoints_) are moved in the grid,
+	// moveControlPoint moves its point without this diff
+	void indexPoints(uint32_t s)
+	{
+		newPoints_.clear();
+		store_.getControlPoints(s, newPoints_);
+
+		size_t n = min(oldPoints_.size(), newPoints_.size());
+		for (size_t i = 0; i < n; ++i)
+			if (!(oldPoints_[i] == newPoints_[i])) points_.move(s, (uint32_t)i, oldPoints_[i], newPoints_[i]);
+		for (size_t i = n; i < oldPoints_.size(); ++i) points_.remove(s, (uint32_t)i, oldPoints_[i]);
+		for (size_t i = n; i < newPoints_.size(); ++i) points_.insert(s, (uint32_t)i, newPoints_[i]);
+	}
+
+	void unindexObject(const ObjGeom* obj)
+	{
+		damageObject(obj);
+		index_.remove(obj->handle_.index);
+	}
+
+	// leaves the index and the store
+	void forgetObject(ObjGeom* obj)
+	{
+		unindexObject(obj);
+		if (store_.valid(obj->handle_))
+		{
+			oldPoints_.clear();
+			store_.getControlPoints(obj->handle_.index, oldPoints_);
+			for (size_t i = 0; i < oldPoints_.size(); ++i) points_.remove(obj->handle_.index, (uint32_t)i, oldPoints_[i]);
+		}
+		store_.remove(obj->handle_);
+		obj->handle_ = Handle();
+	}
+
+	void damageObject(const ObjGeom* obj)
+	{
+		if (!store_.valid(obj->handle_)) return;
+		const SceneStore::Box& b = store_.box(obj->handle_.index);
+		damageRegion(V2(b.x0, b.y0), V2(b.x1 - b.x0, b.y1 - b.y0));
+	}
+
+	// to draw again on the screen and in the ID buffer
+	void damageRegion(V2 P, V2 size)
+	{
+		damage.add(P, size);
+		ids_.invalidate(P, size);
+	}
+
+	void insertSorted(const shared_ptr<ObjGeom>& obj)
+	{
+		topZ_    = max(topZ_, obj->zOrder_);
+		bottomZ_ = min(bottomZ_, obj->zOrder_);
+		LObjets.byZ_.emplace(obj->zOrder_, obj);
+	}
+
   public :
 
 	shared_ptr<Tool> currentTool;
@@ -26,12 +219,257 @@ class Model
 
 	ObjAttr drawingOptions;
 
-	vector< shared_ptr<ObjGeom> > LObjets;
+	// drawn from first to last : read it freely, but modify it only with the functions below
+	// so that the spatial index stays in sync
+	ObjectList LObjets;
 
 	vector< shared_ptr<Button> > LButtons;
 
+	// updated by the functions below, consumed by drawApp
+	mutable Damage damage;
+
 	Model()
 	{
 		initApp(*this);
 	}
+
+	unsigned long long revision() const { return revision_; }
+
+	// same scene as LObjets, as arrays
+	const SceneStore& store() const { return store_; }
+
+	// add a new object on top of the scene
+	void addObject(shared_ptr<ObjGeom> obj)
+	{
+		if (!obj) return;
+		revision_++;
+		obj->zOrder_ = ++topZ_;
+		LObjets.byZ_.emplace_hint(LObjets.byZ_.end(), obj->zOrder_, obj);
+		indexObject(obj.get());
+	}
+
+	// put back an object at its previous depth (zOrder_ kept from its removal)
+	void insertObject(shared_ptr<ObjGeom> obj)
+	{
+		if (!obj) return;
+		revision_++;
+		insertSorted(obj);
+		indexObject(obj.get());
+	}
+
+	void removeObject(const ObjGeom* obj)
+	{
+		auto it = find(obj);
+		if (it == LObjets.byZ_.end()) return;
+		revision_++;
+		forgetObject(it->second.get());
+		LObjets.byZ_.erase(it);
+	}
+
+	void clearObjects()
+	{
+		revision_++;
+		for (auto& obj : LObjets) obj->handle_ = Handle();
+		LObjets.byZ_.clear();
+		index_.clear();
+		store_.clear();
+		points_.clear();
+		topZ_ = bottomZ_ = 0;
+		damage.addAll();
+		ids_.invalidateAll();
+	}
+
+	// replace the whole scene, the objects must be sorted by zOrder_
+	void replaceObjects(const vector< shared_ptr<ObjGeom> >& objects)
+	{
+		revision_++;
+		clearObjects();
+		for (auto& obj : objects)
+			LObjets.byZ_.emplace_hint(LObjets.byZ_.end(), obj->zOrder_, obj);
+		if (!LObjets.empty())
+		{
+			bottomZ_ = min(0LL, LObjets.front()->zOrder_);
+			topZ_    = max(0LL, LObjets.back()->zOrder_);
+		}
+		for (auto& obj : LObjets)
+			indexObject(obj.get());
+	}
+
+	// move object to front (end of list = drawn last = on top)
+	void bringToFront(const ObjGeom* obj)
+	{
+		auto it = find(obj);
+		if (it == LObjets.byZ_.end()) return;
+		revision_++;
+		auto keep = it->second;
+		LObjets.byZ_.erase(it);
+		keep->zOrder_ = ++topZ_;
+		LObjets.byZ_.emplace_hint(LObjets.byZ_.end(), keep->zOrder_, keep);
+		store_.setZ(keep->handle_, keep->zOrder_);
+		damageObject(obj);
+	}
+
+	// move object to back (start of list = drawn first = behind)
+	void sendToBack(const ObjGeom* obj)
+	{
+		auto it = find(obj);
+		if (it == LObjets.byZ_.end()) return;
+		revision_++;
+		auto keep = it->second;
+		LObjets.byZ_.erase(it);
+		keep->zOrder_ = --bottomZ_;
+		LObjets.byZ_.emplace_hint(LObjets.byZ_.begin(), keep->zOrder_, keep);
+		store_.setZ(keep->handle_, keep->zOrder_);
+		damageObject(obj);
+	}
+
+	// move an object back to a depth it had before
+	void setZOrder(const ObjGeom* obj, long long z)
+	{
+		auto it = find(obj);
+		if (it == LObjets.byZ_.end()) return;
+		revision_++;
+		auto keep = it->second;
+		LObjets.byZ_.erase(it);
+		keep->zOrder_ = z;
+		insertSorted(keep);
+		store_.setZ(keep->handle_, keep->zOrder_);
+		damageObject(obj);
+	}
+
+	// call after the geometry or the thickness of an object has been modified
+	void objectChanged(ObjGeom* obj)
+	{
+		revision_++;
+		obj->touch();
+		unindexObject(obj);   // old region
+		indexObject(obj);     // new region
+	}
+
+	// moves the i-th control point of obj (ToolEditPoints, CmdEditPoint)
+	// setControlPoint touches the object and updates its caches in place,
+	// a second touch() as in objectChanged would throw them away
+	void moveControlPoint(ObjGeom* obj, size_t i, const V2& p)
+	{
+		if (!obj->getControlPoint(i)) return;
+
+		// object out of the scene (deleted, held by a tool) : it must not enter the store
+		if (!store_.valid(obj->handle_) || store_.object(obj->handle_.index) != obj) { obj->setControlPoint(i, p); return; }
+
+		revision_++;
+		unindexObject(obj);
+		obj->setControlPoint(i, p);
+
+		// the structure is unchanged : one point of the row is written, one entry of the grid is moved
+		uint32_t s = obj->handle_.index;
+		SceneStore::Box box = indexBox(obj);
+		V2 old = store_.controlPoint(s, (uint32_t)i);
+		store_.setPoint(obj->handle_, (uint32_t)i, p, box);
+		if (!(old == p)) points_.move(s, (uint32_t)i, old, p);
+		indexRegion(s, box);
+	}
+
+	// topmost object containing p, nullptr if none
+	shared_ptr<ObjGeom> pick(const V2& p)
+	{
+		vector<uint32_t> candidates;
+		index_.query(p, candidates);
+
+		// search from top to bottom, on the arrays of the store
+		sort(candidates.begin(), candidates.end(),
+			[this](uint32_t a, uint32_t b) { return store_.z(a) > store_.z(b); });
+
+		for (uint32_t s : candidates)
+			if (store_.contains(s, p))
+				return find(store_.object(s))->second;
+
+		return nullptr;
+	}
+
+	// control point grabbed at p : the topmost object having a point within radius of p,
+	// and its closest point (index in getControlPoints), nullptr if none
+	shared_ptr<ObjGeom> pickControlPoint(const V2& p, int radius, size_t& index)
+	{
+		vector<ControlPointIndex::Entry> near;
+		points_.query(p - V2(radius, radius), V2(2 * radius, 2 * radius), near);
+
+		const ControlPointIndex::Entry* best = nullptr;
+		double bestDist = 0;
+		for (const auto& E : near)
+		{
+			double d = (E.p - p).norm();
+			if (d > radius) continue;
+
+			// same choice as the scan of the objects from top to bottom
+			if (best && store_.z(E.slot) < store_.z(best->slot)) continue;
+			if (best && store_.z(E.slot) == store_.z(best->slot) && (d > bestDist || (d == bestDist && E.point < best->point))) continue;
+			best = &E;
+			bestDist = d;
+		}
+		if (!best) return nullptr;
+
+		index = best->point;
+		return find(store_.object(best->slot))->second;
+	}
+
+	// control points inside the region P/size
+	void controlPointsIn(V2 P, V2 size, vector<V2>& out) const
+	{
+		vector<ControlPointIndex::Entry> found;
+		points_.query(P, size, found);
+		for (const auto& E : found) out.push_back(E.p);
+	}
+
+	// store slots of the objects whose drawn area (box of the spatial index) crosses the region P/size,
+	// in drawing order : the objects elsewhere are not read
+	void slotsInRegion(V2 P, V2 size, vector<uint32_t>& out) const
+	{
+		size_t first = out.size();
+		index_.queryRegion(P, size, out);
+		sort(out.begin() + first, out.end(),
+			[this](uint32_t a, uint32_t b) { return store_.z(a) < store_.z(b); });
+	}
+
+	// objects whose bounding box intersects the region P/size, or is inside it if contained,
+	// in drawing order : only the candidates of the spatial index are tested
+	void objectsInRegion(V2 P, V2 size, bool contained, vector< shared_ptr<ObjGeom> >& out)
+	{
+		vector<uint32_t> candidates;
+		slotsInRegion(P, size, candidates);
+
+		for (uint32_t s : candidates)
+		{
+			V2 B, Bsize;
+			store_.object(s)->getBoundingBox(B, Bsize);
+			bool inside    = B.x >= P.x && B.y >= P.y && B.x + Bsize.x <= P.x + size.x && B.y + Bsize.y <= P.y + size.y;
+			bool intersect = B.x <= P.x + size.x && P.x <= B.x + Bsize.x && B.y <= P.y + size.y && P.y <= B.y + Bsize.y;
+			if (contained ? inside : intersect)
+				out.push_back(find(store_.object(s))->second);
+		}
+	}
+
+	// area covered by the ID buffer, the window : set by drawApp
+	void setViewSize(V2 size) const { ids_.resize(size); }
+
+	// slot of the object drawn at p (see IdBuffer), IdBuffer::None if none or outside the window
+	uint32_t slotAt(const V2& p) const
+	{
+		if (ids_.needsRefresh()) ids_.refresh(store_, index_);
+		return ids_.at(p);
+	}
+
+	const ObjGeom* objectAt(const V2& p) const
+	{
+		uint32_t s = slotAt(p);
+		return (s == IdBuffer::None) ? nullptr : store_.object(s);
+	}
+
+	// topmost object drawn at p, read in the ID buffer
+	// outside the window (or before the first frame) : geometric pick
+	shared_ptr<ObjGeom> pickDrawn(const V2& p)
+	{
+		if (!ids_.covers(p)) return pick(p);
+		const ObjGeom* obj = objectAt(p);
+		return obj ? find(obj)->second : nullptr;
+	}
 };
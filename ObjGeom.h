@@ -5,22 +5,84 @@
 #include "V2.h"
 #include "ObjAttr.h"
 #include "Graphics.h"
+#include "ObjPool.h"
+#include "GeomKernels.h"
+#include "CircleTable.h"
 #include <sstream>
 #include <memory>
 #include <vector>
+#include <cstdint>
+
+
+// generation-checked reference to a slot of the SceneStore
+// a slot is reused after a removal with a new generation, so an old handle is detected
+struct Handle
+{
+	uint32_t index      = UINT32_MAX;
+	uint32_t generation = 0;
+
+	bool isNull() const { return index == UINT32_MAX; }
+	bool operator==(const Handle& h) const { return index == h.index && generation == h.generation; }
+};
 
 
 class ObjGeom
 {
+	// boxes cached until the next touch()
+	struct Bounds
+	{
+		unsigned long long version = 0;
+		V2 box, boxSize;
+		V2 pick, pickSize;
+		V2 stroke, strokeSize;
+	};
+	mutable Bounds bounds_;
+
+	const Bounds& bounds() const
+	{
+		if (bounds_.version != version_)
+		{
+			computeBoundingBox(bounds_.box, bounds_.boxSize);
+			computePickBox(bounds_.pick, bounds_.pickSize);
+			int half = (drawInfo_.thickness_ + 1) / 2;
+			bounds_.stroke     = bounds_.box - V2(half, half);
+			bounds_.strokeSize = bounds_.boxSize + V2(2 * half, 2 * half);
+			bounds_.version = version_;
+		}
+		return bounds_;
+	}
+
+protected :
+	// geometry of the boxes, called once per version
+	virtual void computeBoundingBox(V2& P, V2& size) const { P = V2(0,0); size = V2(0,0); }
+
+	// box of the area where contains() may answer true (bounding box + selection tolerance)
+	virtual void computePickBox(V2& P, V2& size) const { computeBoundingBox(P, size); }
+
 public :
 	ObjAttr drawInfo_;
+	long long zOrder_ = 0;   // set by Model, increases from back to front
+	Handle    handle_;       // set by Model, null when the object is not in the scene
+	unsigned long long version_ = nextVersion();   // unique among all objects, changed by every edit
 
 	ObjGeom() {}
 	ObjGeom(ObjAttr  drawInfo) : drawInfo_(drawInfo)   {  }
 
+	static unsigned long long nextVersion() { static unsigned long long counter = 0; return ++counter; }
+
+	// call after any modification, so that the caches built on the object are refreshed
+	void touch() { version_ = nextVersion(); }
+
+	void getBoundingBox(V2& P, V2& size) const { P = bounds().box;    size = bounds().boxSize; }
+	void getPickBox(V2& P, V2& size)     const { P = bounds().pick;   size = bounds().pickSize; }
+
+	// bounding box grown by half the border thickness : the drawn area
+	void getStrokeBox(V2& P, V2& size)   const { P = bounds().stroke; size = bounds().strokeSize; }
+
 	virtual void draw(Graphics & G) {}
 
-	virtual void getBoundingBox(V2& P, V2& size) const { P = V2(0,0); size = V2(0,0); }
+	// geometry of draw() as vertex lists : fill triangles, border segments of thickness drawInfo_.thickness_
+	virtual void tessellate(std::vector<GVertex>& fill, std::vector<GVertex>& lines) const {}
 
 	virtual bool contains(const V2& p) const
 	{
@@ -32,7 +94,44 @@ public :
 	virtual void getControlPoints(std::vector<V2>& out) const { }
 
 	virtual V2* findClosestControlPoint(const V2& mouse, float maxDist) { return nullptr; }
-	virtual std::string serialize() const = 0;   
+
+	// i-th control point, in the getControlPoints() order, nullptr past the end
+	// a point modified through this pointer needs a touch(), see setControlPoint
+	virtual V2* getControlPoint(size_t i) { return nullptr; }
+
+	void setControlPoint(size_t i, const V2& p)
+	{
+		V2* q = getControlPoint(i);
+		if (!q) return;
+		*q = p;
+		unsigned long long before = version_;
+		touch();
+		controlPointMoved(i, before);
+	}
+
+protected :
+	// called by setControlPoint after the touch(), for the caches that can be updated in place
+	// previous : version_ before the move
+	virtual void controlPointMoved(size_t i, unsigned long long previous) {}
+
+public :
+
+	// memory held by the object, used to report the cost of the undo history
+	virtual size_t memoryBytes() const { return sizeof(ObjGeom); }
+
+	virtual std::string serialize() const = 0;
+
+	// attributes in the text format, shared by the shapes
+	static void writeAttr(std::ostream& ss, const ObjAttr& A)
+	{
+		ss	<< A.borderColor_.R << ' ' << A.borderColor_.G << ' '
+			<< A.borderColor_.B << ' ' << A.borderColor_.A << ' '
+			<< A.isFilled_ << ' '
+			<< A.interiorColor_.R << ' ' << A.interiorColor_.G << ' '
+			<< A.interiorColor_.B << ' ' << A.interiorColor_.A << ' '
+			<< A.thickness_ << ' ';
+	}
+   
 	static std::shared_ptr<ObjGeom> deserialize(const std::string& line);
 
 };
@@ -61,28 +160,53 @@ public :
 		G.drawRectangle(P, size, drawInfo_.borderColor_, false, drawInfo_.thickness_);
 	}
 
-	void getBoundingBox(V2& P, V2& size) const override
+	static void tessellate(const ObjAttr& Attr, const V2& P1, const V2& P2, std::vector<GVertex>& fill, std::vector<GVertex>& lines)
+	{
+		V2 P, size;
+		getPLH(P1, P2, P, size);
+		V2 A = P, B = P + V2(size.x, 0), C = P + size, D = P + V2(0, size.y);
+
+		if (Attr.isFilled_)
+		{
+			Color c = Attr.interiorColor_;
+			fill.insert(fill.end(), { GVertex(A, c), GVertex(B, c), GVertex(C, c), GVertex(A, c), GVertex(C, c), GVertex(D, c) });
+		}
+
+		Color c = Attr.borderColor_;
+		lines.insert(lines.end(), { GVertex(A, c), GVertex(B, c), GVertex(B, c), GVertex(C, c),
+		                            GVertex(C, c), GVertex(D, c), GVertex(D, c), GVertex(A, c) });
+	}
+
+	void tessellate(std::vector<GVertex>& fill, std::vector<GVertex>& lines) const override
+	{
+		tessellate(drawInfo_, P1_, P2_, fill, lines);
+	}
+
+	void computeBoundingBox(V2& P, V2& size) const override
 	{
 		getPLH(P1_, P2_, P, size);
 	}
 
-	bool contains(const V2& p) const override
+	static bool hit(const V2& P1, const V2& P2, const V2& p)
 	{
 		V2 P; V2 size;
-		getBoundingBox(P, size);
+		getPLH(P1, P2, P, size);
 		return (p.x >= P.x && p.x <= P.x + size.x && p.y >= P.y && p.y <= P.y + size.y);
 	}
+
+	bool contains(const V2& p) const override { return hit(P1_, P2_, p); }
+
+	static void write(std::ostream& ss, const ObjAttr& A, const V2& P1, const V2& P2)
+	{
+		ss << "RECT ";
+		writeAttr(ss, A);
+		ss << P1.x << ' ' << P1.y << ' ' << P2.x << ' ' << P2.y;
+	}
+
 	std::string serialize() const override
 	{
 		std::ostringstream ss;
-		ss << "RECT "
-			<< drawInfo_.borderColor_.R << ' ' << drawInfo_.borderColor_.G << ' '
-			<< drawInfo_.borderColor_.B << ' ' << drawInfo_.borderColor_.A << ' '
-			<< drawInfo_.isFilled_ << ' '
-			<< drawInfo_.interiorColor_.R << ' ' << drawInfo_.interiorColor_.G << ' '
-			<< drawInfo_.interiorColor_.B << ' ' << drawInfo_.interiorColor_.A << ' '
-			<< drawInfo_.thickness_ << ' '
-			<< P1_.x << ' ' << P1_.y << ' ' << P2_.x << ' ' << P2_.y;
+		write(ss, drawInfo_, P1_, P2_);
 		return ss.str();
 	}
 
@@ -106,6 +230,10 @@ public :
 		return best;
 	}
 
+	V2* getControlPoint(size_t i) override { return (i == 0) ? &P1_ : (i == 1) ? &P2_ : nullptr; }
+
+	size_t memoryBytes() const override { return sizeof(ObjRectangle); }
+
 };
 
 
@@ -128,7 +256,18 @@ public:
 		G.drawLine(P1_, P2_, drawInfo_.borderColor_, drawInfo_.thickness_);
 	}
 
-	void getBoundingBox(V2& P, V2& size) const override
+	static void tessellate(const ObjAttr& A, const V2& P1, const V2& P2, std::vector<GVertex>& fill, std::vector<GVertex>& lines)
+	{
+		lines.push_back(GVertex(P1, A.borderColor_));
+		lines.push_back(GVertex(P2, A.borderColor_));
+	}
+
+	void tessellate(std::vector<GVertex>& fill, std::vector<GVertex>& lines) const override
+	{
+		tessellate(drawInfo_, P1_, P2_, fill, lines);
+	}
+
+	void computeBoundingBox(V2& P, V2& size) const override
 	{
 		int xmin = std::min(P1_.x, P2_.x);
 		int ymin = std::min(P1_.y, P2_.y);
@@ -140,36 +279,47 @@ public:
 		size = V2(xmax - xmin, ymax - ymin);
 	}
 
-	bool contains(const V2& p) const override
+	void computePickBox(V2& P, V2& size) const override
+	{
+		int tol = drawInfo_.thickness_ + 4;
+		getPLH(P1_, P2_, P, size);
+		P = P - V2(tol, tol);
+		size = size + V2(2 * tol, 2 * tol);
+	}
+
+	static bool hit(const V2& P1, const V2& P2, int thickness, const V2& p)
 	{
 		// distncia ponto->segmento com tolerncia
 		double x0 = p.x, y0 = p.y;
-		double x1 = P1_.x, y1 = P1_.y;
-		double x2 = P2_.x, y2 = P2_.y;
+		double x1 = P1.x, y1 = P1.y;
+		double x2 = P2.x, y2 = P2.y;
 		double dx = x2 - x1, dy = y2 - y1;
 		if (dx == 0 && dy == 0) {
 			double d2 = (x0-x1)*(x0-x1) + (y0-y1)*(y0-y1);
-			double tol = drawInfo_.thickness_ + 3;
+			double tol = thickness + 3;
 			return d2 <= tol*tol;
 		}
 		double t = ((x0-x1)*dx + (y0-y1)*dy) / (dx*dx + dy*dy);
 		if (t < 0) t = 0; else if (t > 1) t = 1;
 		double px = x1 + t*dx, py = y1 + t*dy;
 		double d2 = (x0-px)*(x0-px) + (y0-py)*(y0-py);
-		double tol = drawInfo_.thickness_ + 4;
+		double tol = thickness + 4;
 		return d2 <= tol*tol;
 	}
+
+	bool contains(const V2& p) const override { return hit(P1_, P2_, drawInfo_.thickness_, p); }
+
+	static void write(std::ostream& ss, const ObjAttr& A, const V2& P1, const V2& P2)
+	{
+		ss << "SEG ";
+		writeAttr(ss, A);
+		ss << P1.x << ' ' << P1.y << ' ' << P2.x << ' ' << P2.y;
+	}
+
 	std::string serialize() const override
 	{
 		std::ostringstream ss;
-		ss << "SEG "
-			<< drawInfo_.borderColor_.R << ' ' << drawInfo_.borderColor_.G << ' '
-			<< drawInfo_.borderColor_.B << ' ' << drawInfo_.borderColor_.A << ' '
-			<< drawInfo_.isFilled_ << ' '
-			<< drawInfo_.interiorColor_.R << ' ' << drawInfo_.interiorColor_.G << ' '
-			<< drawInfo_.interiorColor_.B << ' ' << drawInfo_.interiorColor_.A << ' '
-			<< drawInfo_.thickness_ << ' '
-			<< P1_.x << ' ' << P1_.y << ' ' << P2_.x << ' ' << P2_.y;
+		write(ss, drawInfo_, P1_, P2_);
 		return ss.str();
 	}
 	void getControlPoints(std::vector<V2>& out) const override
@@ -192,6 +342,10 @@ public:
 		return best;
 	}
 
+	V2* getControlPoint(size_t i) override { return (i == 0) ? &P1_ : (i == 1) ? &P2_ : nullptr; }
+
+	size_t memoryBytes() const override { return sizeof(ObjSegment); }
+
 };
 
 
@@ -225,7 +379,41 @@ public:
 	
 	}
 
-	void getBoundingBox(V2& P, V2& size) const override
+	static void tessellate(const ObjAttr& A, const V2& C, const V2& P2, std::vector<GVertex>& fill, std::vector<GVertex>& lines)
+	{
+		V2 diff = P2 - C;
+		float r = (float)(int)diff.norm();
+
+		// a triangle and a segment from the previous vertex to each new one
+		GVertex center(C, A.interiorColor_);
+		float px = 0, py = 0;
+		bool first = true;
+
+		circlePoints((float)C.x, (float)C.y, r, circleSides(r), [&](float x, float y)
+		{
+			if (!first)
+			{
+				if (A.isFilled_)
+				{
+					fill.push_back(center);
+					fill.push_back(GVertex(px, py, A.interiorColor_));
+					fill.push_back(GVertex(x, y, A.interiorColor_));
+				}
+				lines.push_back(GVertex(px, py, A.borderColor_));
+				lines.push_back(GVertex(x, y, A.borderColor_));
+			}
+			px = x;
+			py = y;
+			first = false;
+		});
+	}
+
+	void tessellate(std::vector<GVertex>& fill, std::vector<GVertex>& lines) const override
+	{
+		tessellate(drawInfo_, P1_, P2_, fill, lines);
+	}
+
+	void computeBoundingBox(V2& P, V2& size) const override
 	{
 		V2 diff = P2_ - P1_;
 		int r = (int)diff.norm();
@@ -233,25 +421,35 @@ public:
 		size = V2(2*r, 2*r);
 	}
 
-	bool contains(const V2& p) const override
+	void computePickBox(V2& P, V2& size) const override
+	{
+		computeBoundingBox(P, size);
+		P = P - V2(2, 2);
+		size = size + V2(4, 4);
+	}
+
+	static bool hit(const V2& C, const V2& P2, const V2& p)
 	{
-		V2 d = p - P1_;
+		V2 d = p - C;
 		double dist = d.norm();
-		V2 diff = P2_ - P1_;
+		V2 diff = P2 - C;
 		double r = diff.norm();
 		return dist <= r + 1.0; // toleranc
 	}
+
+	bool contains(const V2& p) const override { return hit(P1_, P2_, p); }
+
+	static void write(std::ostream& ss, const ObjAttr& A, const V2& P1, const V2& P2)
+	{
+		ss << "CIRC ";
+		writeAttr(ss, A);
+		ss << P1.x << ' ' << P1.y << ' ' << P2.x << ' ' << P2.y;
+	}
+
 	std::string serialize() const override
 	{
 		std::ostringstream ss;
-		ss << "CIRC "
-			<< drawInfo_.borderColor_.R << ' ' << drawInfo_.borderColor_.G << ' '
-			<< drawInfo_.borderColor_.B << ' ' << drawInfo_.borderColor_.A << ' '
-			<< drawInfo_.isFilled_ << ' '
-			<< drawInfo_.interiorColor_.R << ' ' << drawInfo_.interiorColor_.G << ' '
-			<< drawInfo_.interiorColor_.B << ' ' << drawInfo_.interiorColor_.A << ' '
-			<< drawInfo_.thickness_ << ' '
-			<< P1_.x << ' ' << P1_.y << ' ' << P2_.x << ' ' << P2_.y;
+		write(ss, drawInfo_, P1_, P2_);
 		return ss.str();
 	}
 	void getControlPoints(std::vector<V2>& out) const override
@@ -274,40 +472,188 @@ public:
 		return best;
 	}
 
+	V2* getControlPoint(size_t i) override { return (i == 0) ? &P1_ : (i == 1) ? &P2_ : nullptr; }
+
+	size_t memoryBytes() const override { return sizeof(ObjCircle); }
+
 };
 
 
+// boxes over the segments of a polyline, on two levels : chunks of Chunk consecutive
+// segments, then groups of Chunk chunks. A point query only tests the segments of the
+// chunks whose box, grown by the selection tolerance, contains the point.
+struct SegmentBoxes
+{
+	static const size_t Chunk = 32;
+
+	struct Node
+	{
+		int x0 = 0, y0 = 0, x1 = -1, y1 = -1;   // box of the points
+		int tol = 0;                            // margin where the segments can be picked
+
+		bool near(const V2& P) const { return P.x >= x0 - tol && P.x <= x1 + tol && P.y >= y0 - tol && P.y <= y1 + tol; }
+
+		void add(const Node& N)
+		{
+			if (x0 > x1) { *this = N; return; }
+			x0 = std::min(x0, N.x0); y0 = std::min(y0, N.y0);
+			x1 = std::max(x1, N.x1); y1 = std::max(y1, N.y1);
+			tol = std::max(tol, N.tol);
+		}
+	};
+
+	std::vector<Node> chunks, groups;
+	unsigned long long version = 0;   // ObjGeom::version_ of the points
+
+	// segments [first, last) of pts
+	static Node makeChunk(const V2* pts, size_t first, size_t last)
+	{
+		Node N;
+		N.x0 = N.x1 = pts[first].x;
+		N.y0 = N.y1 = pts[first].y;
+		double tol = 2;
+		for (size_t i = first; i < last; ++i)
+		{
+			const V2& B = pts[i + 1];
+			N.x0 = std::min(N.x0, B.x); N.y0 = std::min(N.y0, B.y);
+			N.x1 = std::max(N.x1, B.x); N.y1 = std::max(N.y1, B.y);
+			tol = std::max(tol, sqrt(2 * (B - pts[i]).norm() + 4));   // see ObjPolyLine::computePickBox
+		}
+		N.tol = (int)tol + 1;
+		return N;
+	}
+
+	void updateChunk(const V2* pts, size_t n, size_t c)
+	{
+		chunks[c] = makeChunk(pts, c * Chunk, std::min(c * Chunk + Chunk, n - 1));
+
+		size_t g = c / Chunk;
+		groups[g] = Node();
+		for (size_t k = g * Chunk; k < std::min(g * Chunk + Chunk, chunks.size()); ++k)
+			groups[g].add(chunks[k]);
+	}
+
+	void build(const V2* pts, size_t n)
+	{
+		size_t nbSegments = (n > 1) ? n - 1 : 0;
+		chunks.resize((nbSegments + Chunk - 1) / Chunk);
+		groups.resize((chunks.size() + Chunk - 1) / Chunk);
+		for (size_t c = 0; c < chunks.size(); ++c)
+			chunks[c] = makeChunk(pts, c * Chunk, std::min(c * Chunk + Chunk, n - 1));
+		for (size_t g = 0; g < groups.size(); ++g)
+		{
+			groups[g] = Node();
+			for (size_t k = g * Chunk; k < std::min(g * Chunk + Chunk, chunks.size()); ++k)
+				groups[g].add(chunks[k]);
+		}
+	}
+
+	// point i has moved : only the chunks of the segments i-1 and i change
+	void pointMoved(const V2* pts, size_t n, size_t i)
+	{
+		if (i > 0) updateChunk(pts, n, (i - 1) / Chunk);
+		if (i + 1 < n && (i == 0 || i / Chunk != (i - 1) / Chunk)) updateChunk(pts, n, i / Chunk);
+	}
+
+	// union of the chunks
+	Node all() const
+	{
+		Node N;
+		for (const Node& G : groups) N.add(G);
+		return N;
+	}
+};
+
 class ObjPolyLine : public ObjGeom
 {
 	std::vector<V2> pts_;
+	mutable SegmentBoxes segments_;   // built on the first query of a long polyline
+
+	const SegmentBoxes& segments() const
+	{
+		if (segments_.version != version_)
+		{
+			segments_.build(pts_.data(), pts_.size());
+			segments_.version = version_;
+		}
+		return segments_;
+	}
+
+protected :
+	void controlPointMoved(size_t i, unsigned long long previous) override
+	{
+		if (segments_.version != previous) return;   // not built or not up to date : rebuilt on demand
+		segments_.pointMoved(pts_.data(), pts_.size(), i);
+		segments_.version = version_;
+	}
 
 public:
+	// above this number of points, contains() and the boxes go through the segment boxes
+	static const size_t LinearMax = 2 * SegmentBoxes::Chunk;
 	ObjPolyLine(const ObjAttr& A, const std::vector<V2>& P)
 		: ObjGeom(A), pts_(P) {}
 
+	const std::vector<V2>& getPoints() const { return pts_; }
+
 	void draw(Graphics& G) override
 	{
 		for (size_t i = 0; i < pts_.size() - 1; ++i)
 			G.drawLine(pts_[i], pts_[i + 1], drawInfo_.borderColor_, drawInfo_.thickness_);
 	}
 
-	bool contains(const V2& P) const override
+	static void tessellate(const ObjAttr& A, const V2* pts, size_t n, std::vector<GVertex>& fill, std::vector<GVertex>& lines)
 	{
-		// seleo simplificada: distncia do ponto a cada segmento
-		for (size_t i = 0; i < pts_.size() - 1; ++i)
+		for (size_t i = 0; i + 1 < n; ++i)
 		{
-			V2 A = pts_[i];
-			V2 B = pts_[i + 1];
+			lines.push_back(GVertex(pts[i], A.borderColor_));
+			lines.push_back(GVertex(pts[i + 1], A.borderColor_));
+		}
+	}
+
+	void tessellate(std::vector<GVertex>& fill, std::vector<GVertex>& lines) const override
+	{
+		tessellate(drawInfo_, pts_.data(), pts_.size(), fill, lines);
+	}
 
-			double L = (B - A).norm();
-			double d = fabs((P - A).norm() + (P - B).norm() - L);
-			if (d < 4.0) return true;
+	static bool hit(const V2* pts, size_t n, const V2& P)
+	{
+		// seleo simplificada: distncia do ponto a cada segmento
+		return n > 1 && geomKernels().firstSegmentHit(pts, n - 1, P, 4.0) < n - 1;
+	}
+
+	// same answer, only the segments of the chunks near P
+	static bool hit(const V2* pts, size_t n, const SegmentBoxes& S, const V2& P)
+	{
+		for (size_t g = 0; g < S.groups.size(); ++g)
+		{
+			if (!S.groups[g].near(P)) continue;
+			for (size_t c = g * SegmentBoxes::Chunk; c < std::min(g * SegmentBoxes::Chunk + SegmentBoxes::Chunk, S.chunks.size()); ++c)
+			{
+				if (!S.chunks[c].near(P)) continue;
+				size_t first = c * SegmentBoxes::Chunk;
+				size_t nb = std::min(first + SegmentBoxes::Chunk, n - 1) - first;
+				if (geomKernels().firstSegmentHit(pts + first, nb, P, 4.0) < nb) return true;
+			}
 		}
 		return false;
 	}
 
-	void getBoundingBox(V2& P, V2& size) const override
+	bool contains(const V2& P) const override
 	{
+		if (pts_.size() <= LinearMax) return hit(pts_.data(), pts_.size(), P);
+		return hit(pts_.data(), pts_.size(), segments(), P);
+	}
+
+	void computeBoundingBox(V2& P, V2& size) const override
+	{
+		if (pts_.size() > LinearMax)
+		{
+			SegmentBoxes::Node N = segments().all();
+			P = V2(N.x0, N.y0);
+			size = V2(N.x1 - N.x0, N.y1 - N.y0);
+			return;
+		}
+
 		int minx = 99999, miny = 99999, maxx = -99999, maxy = -99999;
 		for (auto& p : pts_)
 		{
@@ -319,20 +665,38 @@ public:
 		P = V2(minx, miny);
 		size = V2(maxx - minx, maxy - miny);
 	}
+
+	void computePickBox(V2& P, V2& size) const override
+	{
+		// contains() accepts an ellipse around each segment AB : |PA| + |PB| < |AB| + 4
+		// its half width is sqrt(2 |AB| + 4), it goes 2 pixels past A and B
+		int t;
+		if (pts_.size() > LinearMax) t = segments().all().tol;
+		else
+		{
+			double tol = 2;
+			for (size_t i = 0; i + 1 < pts_.size(); ++i)
+				tol = std::max(tol, sqrt(2 * (pts_[i + 1] - pts_[i]).norm() + 4));
+			t = (int)tol + 1;
+		}
+		computeBoundingBox(P, size);
+		P = P - V2(t, t);
+		size = size + V2(2 * t, 2 * t);
+	}
+	static void write(std::ostream& ss, const ObjAttr& A, const V2* pts, size_t n)
+	{
+		ss << "POLY ";
+		writeAttr(ss, A);
+
+		ss << n << ' ';
+		for (size_t i = 0; i < n; ++i)
+			ss << pts[i].x << ' ' << pts[i].y << ' ';
+	}
+
 	std::string serialize() const override
 	{
 		std::ostringstream ss;
-		ss << "POLY "
-			<< drawInfo_.borderColor_.R << ' ' << drawInfo_.borderColor_.G << ' '
-			<< drawInfo_.borderColor_.B << ' ' << drawInfo_.borderColor_.A << ' '
-			<< drawInfo_.isFilled_ << ' '
-			<< drawInfo_.interiorColor_.R << ' ' << drawInfo_.interiorColor_.G << ' '
-			<< drawInfo_.interiorColor_.B << ' ' << drawInfo_.interiorColor_.A << ' '
-			<< drawInfo_.thickness_ << ' ';
-
-		ss << pts_.size() << ' ';
-		for (const auto& p : pts_)
-			ss << p.x << ' ' << p.y << ' ';
+		write(ss, drawInfo_, pts_.data(), pts_.size());
 		return ss.str();
 	}
 	void getControlPoints(std::vector<V2>& out) const override
@@ -358,6 +722,14 @@ public:
 		return best;
 	}
 
+	V2* getControlPoint(size_t i) override { return (i < pts_.size()) ? &pts_[i] : nullptr; }
+
+	size_t memoryBytes() const override
+	{
+		return sizeof(ObjPolyLine) + pts_.capacity() * sizeof(V2)
+			+ (segments_.chunks.capacity() + segments_.groups.capacity()) * sizeof(SegmentBoxes::Node);
+	}
+
 };
 
 
@@ -387,7 +759,7 @@ inline std::shared_ptr<ObjGeom> ObjGeom::deserialize(const std::string& line)
 		readAttr(a);
 		int x1, y1, x2, y2;
 		ss >> x1 >> y1 >> x2 >> y2;
-		return std::make_shared<ObjRectangle>(a, V2(x1, y1), V2(x2, y2));
+		return makeObject<ObjRectangle>(a, V2(x1, y1), V2(x2, y2));
 	}
 	else if (type == "SEG")
 	{
@@ -395,7 +767,7 @@ inline std::shared_ptr<ObjGeom> ObjGeom::deserialize(const std::string& line)
 		readAttr(a);
 		int x1, y1, x2, y2;
 		ss >> x1 >> y1 >> x2 >> y2;
-		return std::make_shared<ObjSegment>(a, V2(x1, y1), V2(x2, y2));
+		return makeObject<ObjSegment>(a, V2(x1, y1), V2(x2, y2));
 	}
 	else if (type == "CIRC")
 	{
@@ -403,7 +775,7 @@ inline std::shared_ptr<ObjGeom> ObjGeom::deserialize(const std::string& line)
 		readAttr(a);
 		int x1, y1, x2, y2;
 		ss >> x1 >> y1 >> x2 >> y2;
-		return std::make_shared<ObjCircle>(a, V2(x1, y1), V2(x2, y2));
+		return makeObject<ObjCircle>(a, V2(x1, y1), V2(x2, y2));
 	}
 	else if (type == "POLY")
 	{
@@ -419,7 +791,7 @@ inline std::shared_ptr<ObjGeom> ObjGeom::deserialize(const std::string& line)
 			ss >> x >> y;
 			pts.emplace_back(x, y);
 		}
-		return std::make_shared<ObjPolyLine>(a, pts);
+		return makeObject<ObjPolyLine>(a, pts);
 	}
 
 	return nullptr;
@@ -0,0 +1,175 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+
+using namespace std;
+
+// pool allocation of the scene objects
+//
+// makeObject<ObjRectangle>(...) replaces make_shared : the object and its shared_ptr
+// counters are taken from a pool of same-size blocks, allocated by chunks of 4096.
+// A freed block goes back to the free list of its pool, the chunks stay reserved so
+// that adding and removing an object never reaches the heap. When the undo history
+// drops its entries, the objects of a cleared or reloaded scene are freed at last :
+// PoolBase::trimAll() then returns the chunks left empty to the heap.
+// Single thread only, as the rest of the application.
+
+struct PoolStats
+{
+	unsigned long long allocations     = 0;   // objects allocated since the start
+	unsigned long long heapAllocations = 0;   // chunks requested to the heap since the start
+	size_t             liveObjects     = 0;
+	size_t             reservedBytes   = 0;   // chunks currently held
+};
+
+class PoolBase
+{
+protected:
+	PoolStats stats_;
+
+	// never destroyed : objects may still be freed by the static destructors at exit
+	static vector<PoolBase*>& registry() { static vector<PoolBase*>* pools = new vector<PoolBase*>; return *pools; }
+
+	PoolBase() { registry().push_back(this); }
+
+	virtual void trim() = 0;
+
+public:
+	// release the empty chunks of every pool, see BlockPool::trim
+	static void trimAll()
+	{
+		for (PoolBase* P : registry()) P->trim();
+	}
+
+	// sum over the pools of all the object types
+	static PoolStats totalStats()
+	{
+		PoolStats T;
+		for (PoolBase* P : registry())
+		{
+			T.allocations     += P->stats_.allocations;
+			T.heapAllocations += P->stats_.heapAllocations;
+			T.liveObjects     += P->stats_.liveObjects;
+			T.reservedBytes   += P->stats_.reservedBytes;
+		}
+		return T;
+	}
+};
+
+template <size_t Size, size_t Align>
+class BlockPool : public PoolBase
+{
+	static const size_t BlocksPerChunk = 4096;
+
+	union Block
+	{
+		Block* next;
+		alignas(Align) unsigned char data[Size];
+	};
+
+	vector< unique_ptr<Block[]> > chunks_;
+	Block* free_ = nullptr;
+
+	void addChunk()
+	{
+		chunks_.emplace_back(new Block[BlocksPerChunk]);
+		Block* C = chunks_.back().get();
+		for (size_t i = 0; i < BlocksPerChunk; ++i)
+		{
+			C[i].next = free_;
+			free_ = &C[i];
+		}
+		stats_.heapAllocations++;
+		stats_.reservedBytes += BlocksPerChunk * sizeof(Block);
+	}
+
+public:
+	static BlockPool& instance() { static BlockPool* pool = new BlockPool; return *pool; }
+
+	void* allocate()
+	{
+		if (!free_) addChunk();
+		Block* B = free_;
+		free_ = B->next;
+		stats_.allocations++;
+		stats_.liveObjects++;
+		return B;
+	}
+
+	void deallocate(void* p)
+	{
+		Block* B = (Block*)p;
+		B->next = free_;
+		free_ = B;
+		stats_.liveObjects--;
+	}
+
+	// returns the chunks without live object to the heap, once at least 2 chunks of blocks
+	// and half of the reserved ones are free : a few objects added and undone keep their chunk
+	void trim() override
+	{
+		size_t total = chunks_.size() * BlocksPerChunk, nbFree = total - stats_.liveObjects;
+		if (nbFree < 2 * BlocksPerChunk || nbFree * 2 < total) return;
+
+		// free blocks of each chunk, found by address
+		vector< pair<Block*, size_t> > starts;   // first block, chunk
+		for (size_t c = 0; c < chunks_.size(); ++c) starts.emplace_back(chunks_[c].get(), c);
+		sort(starts.begin(), starts.end());
+		auto chunkOf = [&](Block* B)
+		{
+			auto it = upper_bound(starts.begin(), starts.end(), make_pair(B, chunks_.size()));
+			return (it - 1)->second;
+		};
+
+		vector<size_t> freeCount(chunks_.size(), 0);
+		for (Block* B = free_; B; B = B->next) freeCount[chunkOf(B)]++;
+
+		// the free list keeps the blocks of the chunks kept, in the same order
+		Block** link = &free_;
+		for (Block* B = free_; B; B = B->next)
+			if (freeCount[chunkOf(B)] < BlocksPerChunk) { *link = B; link = &B->next; }
+		*link = nullptr;
+
+		size_t kept = 0;
+		for (size_t c = 0; c < chunks_.size(); ++c)
+			if (freeCount[c] < BlocksPerChunk) chunks_[kept++] = move(chunks_[c]);
+		chunks_.resize(kept);
+		stats_.reservedBytes = kept * BlocksPerChunk * sizeof(Block);
+	}
+};
+
+// allocator given to allocate_shared, rebound by the library to its control block type
+template <class T>
+struct PoolAllocator
+{
+	typedef T value_type;
+
+	PoolAllocator() {}
+	template <class U> PoolAllocator(const PoolAllocator<U>&) {}
+
+	T* allocate(size_t n)
+	{
+		if (n != 1) return allocator<T>().allocate(n);
+		return (T*)BlockPool<sizeof(T), alignof(T)>::instance().allocate();
+	}
+
+	void deallocate(T* p, size_t n)
+	{
+		if (n != 1) { allocator<T>().deallocate(p, n); return; }
+		BlockPool<sizeof(T), alignof(T)>::instance().deallocate(p);
+	}
+
+	template <class U> bool operator==(const PoolAllocator<U>&) const { return true; }
+	template <class U> bool operator!=(const PoolAllocator<U>&) const { return false; }
+};
+
+template <class T, class... Args>
+shared_ptr<T> makeObject(Args&&... args)
+{
+	return allocate_shared<T>(PoolAllocator<T>(), forward<Args>(args)...);
+}
@@ -0,0 +1,187 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include "Graphics.h"
+
+using namespace std;
+
+// time spent in each phase of drawApp() and in processEvent(), and a few counters per frame
+//
+// the last samples of each phase are kept in a ring buffer and the percentiles
+// are computed on this window. The drawing phases are summed over a frame (the
+// static layer may be drawn once per damaged region), the events are sampled one
+// by one. With OpenGL the times are the CPU cost of issuing the commands.
+
+enum class Phase { Event, Clear, Objects, Buttons, ToolLayer, FrameCache, ToolOverlay, Cursor, Frame, Count };
+
+// values reported once per frame, not times
+enum class Counter { ObjectsDrawn, ObjectsCulled, StateChanges, StatesSkipped, Count };
+
+class Profiler
+{
+public:
+	static const int Window = 240;   // samples kept per phase
+
+	struct Stats
+	{
+		long long count = 0;           // samples since the start
+		double mean = 0, p50 = 0, p95 = 0, p99 = 0, max = 0;   // us, on the window
+	};
+
+private:
+	struct Track
+	{
+		vector<double> samples;        // ring buffer
+		size_t    next    = 0;
+		long long count   = 0;
+		double    current = 0;         // sum of the current frame
+	};
+
+	Track tracks_[(int)Phase::Count];
+	Track counters_[(int)Counter::Count];   // current : last value set, kept until the next one
+
+	void push(Track& T, double us)
+	{
+		if (T.samples.size() < Window) T.samples.push_back(us);
+		else T.samples[T.next] = us;
+		T.next = (T.next + 1) % Window;
+		T.count++;
+	}
+
+	Stats stats(const Track& T) const
+	{
+		Stats S;
+		S.count = T.count;
+		if (T.samples.empty()) return S;
+
+		vector<double> v = T.samples;
+		sort(v.begin(), v.end());
+		auto at = [&](double q) { return v[min(v.size() - 1, (size_t)(q * v.size()))]; };
+
+		for (double t : v) S.mean += t;
+		S.mean /= v.size();
+		S.p50 = at(0.50);
+		S.p95 = at(0.95);
+		S.p99 = at(0.99);
+		S.max = v.back();
+		return S;
+	}
+
+public:
+	bool showOverlay = false;
+
+	static const char* name(Phase p)
+	{
+		static const char* names[] = { "event", "clear", "objects", "buttons", "tool layer", "frame cache", "tool overlay", "cursor", "frame" };
+		return names[(int)p];
+	}
+
+	static const char* name(Counter c)
+	{
+		static const char* names[] = { "objects drawn", "objects culled", "state changes", "states skipped" };
+		return names[(int)c];
+	}
+
+	void set(Counter c, double value) { counters_[(int)c].current = value; }
+
+	void add(Phase p, double us)
+	{
+		if (p == Phase::Event) push(tracks_[(int)p], us);
+		else tracks_[(int)p].current += us;
+	}
+
+	// stores the sums of the frame, phases not reached count as 0
+	void endFrame()
+	{
+		for (int i = 0; i < (int)Phase::Count; ++i)
+			if (i != (int)Phase::Event)
+			{
+				push(tracks_[i], tracks_[i].current);
+				tracks_[i].current = 0;
+			}
+		for (Track& T : counters_) push(T, T.current);
+	}
+
+	Stats stats(Phase p)   const { return stats(tracks_[(int)p]); }
+	Stats stats(Counter c) const { return stats(counters_[(int)c]); }
+
+	bool saveCSV(const string& filename) const
+	{
+		ofstream out(filename);
+		if (!out) return false;
+
+		out << "phase,count,mean_us,p50_us,p95_us,p99_us,max_us\n";
+		for (int i = 0; i < (int)Phase::Count; ++i)
+		{
+			Stats S = stats((Phase)i);
+			out << name((Phase)i) << "," << S.count << fixed << setprecision(1) << "," << S.mean
+				<< "," << S.p50 << "," << S.p95 << "," << S.p99 << "," << S.max << "\n";
+		}
+
+		// same columns, in number of objects or state changes
+		for (int i = 0; i < (int)Counter::Count; ++i)
+		{
+			Stats S = stats((Counter)i);
+			out << name((Counter)i) << "," << S.count << fixed << setprecision(1) << "," << S.mean
+				<< "," << S.p50 << "," << S.p95 << "," << S.p99 << "," << S.max << "\n";
+		}
+		return (bool)out;
+	}
+
+	// table in the top left corner of the window
+	void draw(Graphics& G) const
+	{
+		const int lineH = 18, nbLines = (int)Phase::Count + 3;
+		V2 size = G.getWindowSize();
+		V2 pos(10, size.y - 10 - nbLines * lineH - 8);
+
+		// opaque : drawRectangle does not blend
+		G.drawRectangle(pos, V2(330, nbLines * lineH + 8), Color::Black, true);
+
+		ostringstream title;
+		title << left << setw(13) << "phase (us)" << right << setw(7) << "p50" << setw(7) << "p95" << setw(7) << "p99";
+		int y = size.y - 10 - lineH;
+		G.drawStringFontMono(V2(pos.x + 6, y), title.str(), 13, 1, Color::Yellow);
+
+		for (int i = 0; i < (int)Phase::Count; ++i)
+		{
+			y -= lineH;
+			Stats S = stats((Phase)i);
+			ostringstream ss;
+			ss << left << setw(13) << name((Phase)i) << right << fixed << setprecision(0)
+				<< setw(7) << S.p50 << setw(7) << S.p95 << setw(7) << S.p99;
+			G.drawStringFontMono(V2(pos.x + 6, y), ss.str(), 13, 1, Color::White);
+		}
+
+		ostringstream counts;
+		counts << "drawn " << (long long)counters_[(int)Counter::ObjectsDrawn].current
+			<< "  culled " << (long long)counters_[(int)Counter::ObjectsCulled].current;
+		G.drawStringFontMono(V2(pos.x + 6, y - lineH), counts.str(), 13, 1, Color::Yellow);
+
+		ostringstream states;
+		states << "states " << (long long)counters_[(int)Counter::StateChanges].current
+			<< "  skipped " << (long long)counters_[(int)Counter::StatesSkipped].current;
+		G.drawStringFontMono(V2(pos.x + 6, y - 2 * lineH), states.str(), 13, 1, Color::Yellow);
+	}
+};
+
+// adds the time spent in its scope to a phase
+class ProfileScope
+{
+	typedef chrono::high_resolution_clock Clock;
+
+	Profiler&         P_;
+	Phase             phase_;
+	Clock::time_point t0_;
+
+public:
+	ProfileScope(Profiler& P, Phase phase) : P_(P), phase_(phase), t0_(Clock::now()) {}
+	~ProfileScope() { P_.add(phase_, chrono::duration<double, micro>(Clock::now() - t0_).count()); }
+};
@@ -0,0 +1,80 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+// scan conversion shared by the software rasterizers (SoftGraphics, IdBuffer)
+// the covered pixels are given to plot(x, y), already clipped
+
+struct RasterClip
+{
+	int x0, y0, x1, y1;   // drawable pixels : x0 <= x < x1, y0 <= y < y1
+
+	bool inside(int x, int y) const { return x >= x0 && x < x1 && y >= y0 && y < y1; }
+};
+
+// even-odd rule, a pixel is covered when its center is inside the polygon
+// cross : scratch buffer, kept by the caller to avoid an allocation per polygon
+template <class Plot>
+void rasterPolygon(const float* X, const float* Y, size_t n, const RasterClip& clip, vector<float>& cross, Plot plot)
+{
+	if (n < 3) return;
+
+	float ymin = *min_element(Y, Y + n);
+	float ymax = *max_element(Y, Y + n);
+	int y0 = max(clip.y0, (int)floor(ymin));
+	int y1 = min(clip.y1 - 1, (int)ceil(ymax));
+
+	for (int y = y0; y <= y1; ++y)
+	{
+		float yc = y + 0.5f;
+		cross.clear();
+
+		for (size_t i = 0; i < n; ++i)
+		{
+			size_t j = (i + 1) % n;
+			float ya = Y[i], yb = Y[j];
+			if ((ya <= yc && yb > yc) || (yb <= yc && ya > yc))
+				cross.push_back(X[i] + (yc - ya) / (yb - ya) * (X[j] - X[i]));
+		}
+		sort(cross.begin(), cross.end());
+
+		for (size_t k = 0; k + 1 < cross.size(); k += 2)
+		{
+			int xa = max(clip.x0, (int)ceil(cross[k] - 0.5f));
+			int xb = min(clip.x1 - 1, (int)ceil(cross[k + 1] - 0.5f) - 1);
+			for (int x = xa; x <= xb; ++x) plot(x, y);
+		}
+	}
+}
+
+// thickness <= 1 : one pixel per step along the main axis, else the rectangle around the segment
+template <class Plot>
+void rasterLine(float x1, float y1, float x2, float y2, int thickness, const RasterClip& clip, vector<float>& cross, Plot plot)
+{
+	float dx = x2 - x1, dy = y2 - y1;
+	float len = sqrt(dx * dx + dy * dy);
+
+	if (thickness <= 1 || len == 0)
+	{
+		int steps = (int)max(fabs(dx), fabs(dy));
+		for (int i = 0; i <= steps; ++i)
+		{
+			float t = (steps == 0) ? 0 : (float)i / steps;
+			int x = (int)floor(x1 + t * dx);
+			int y = (int)floor(y1 + t * dy);
+			if (clip.inside(x, y)) plot(x, y);
+		}
+		return;
+	}
+
+	float h = thickness * 0.5f;
+	float nx = -dy / len * h, ny = dx / len * h;
+	float X[4] = { x1 + nx, x2 + nx, x2 - nx, x1 - nx };
+	float Y[4] = { y1 + ny, y2 + ny, y2 - ny, y1 - ny };
+	rasterPolygon(X, Y, 4, clip, cross, plot);
+}
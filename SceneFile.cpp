@@ -0,0 +1,236 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <cstring>
+#include <cstdint>
+#include "SceneFile.h"
+
+using namespace std;
+
+/////////////////////////////////////////////////////////////
+//
+//	    File layout
+//
+/////////////////////////////////////////////////////////////
+
+static const char     MAGIC[4] = { 'P', 'S', 'C', 'N' };
+static const uint32_t VERSION  = 1;
+
+enum class RecordType : uint8_t { Rect = 1, Seg = 2, Circ = 3, Poly = 4 };
+
+struct FileHeader
+{
+	char     magic[4];
+	uint32_t version;
+	uint32_t styleCount;
+	uint32_t objectCount;
+	uint32_t pointCount;
+};
+
+struct StyleRecord
+{
+	float    border[4];    // R G B A
+	float    interior[4];
+	int32_t  thickness;
+	uint32_t isFilled;
+};
+
+struct ObjectRecord
+{
+	uint8_t  type;         // RecordType
+	uint8_t  unused[3];
+	uint32_t style;        // index in the style table
+	int32_t  coords[4];    // P1.x P1.y P2.x P2.y, unused for POLY
+};
+
+static_assert(sizeof(FileHeader)   == 20, "packed header expected");
+static_assert(sizeof(StyleRecord)  == 40, "packed style record expected");
+static_assert(sizeof(ObjectRecord) == 24, "packed object record expected");
+
+
+bool isBinarySceneFile(const string& filename)
+{
+	return filename.size() >= 5 && filename.compare(filename.size() - 5, 5, ".pbin") == 0;
+}
+
+static StyleRecord toRecord(const ObjAttr& A)
+{
+	StyleRecord S;
+	memset(&S, 0, sizeof(S));
+	const Color& b = A.borderColor_;
+	const Color& i = A.interiorColor_;
+	S.border[0]   = b.R; S.border[1]   = b.G; S.border[2]   = b.B; S.border[3]   = b.A;
+	S.interior[0] = i.R; S.interior[1] = i.G; S.interior[2] = i.B; S.interior[3] = i.A;
+	S.thickness = A.thickness_;
+	S.isFilled  = A.isFilled_ ? 1 : 0;
+	return S;
+}
+
+static ObjAttr fromRecord(const StyleRecord& S)
+{
+	Color b(S.border[0], S.border[1], S.border[2], S.border[3]);
+	Color i(S.interior[0], S.interior[1], S.interior[2], S.interior[3]);
+	return ObjAttr(b, S.isFilled != 0, i, S.thickness);
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Save
+//
+/////////////////////////////////////////////////////////////
+
+bool saveBinaryScene(const string& filename, const SceneStore& scene)
+{
+	vector<StyleRecord>  styles;
+	vector<ObjectRecord> records;
+	vector<int32_t>      points;        // count, x0, y0, x1, y1 ... for each POLY
+	map<string, uint32_t> styleIndex;   // raw bytes of a StyleRecord -> index
+	uint32_t pointCount = 0;
+
+	records.reserve(scene.size());
+
+	for (auto& e : scene.order())
+	{
+		uint32_t s = e.second;
+		const SceneStore::Shapes& T = scene.shapes(scene.type(s));
+		uint32_t r = scene.row(s);
+
+		StyleRecord S = toRecord(T.attr[r]);
+		string key((const char*)&S, sizeof(S));
+		auto it = styleIndex.find(key);
+		if (it == styleIndex.end())
+		{
+			it = styleIndex.insert({ key, (uint32_t)styles.size() }).first;
+			styles.push_back(S);
+		}
+
+		ObjectRecord R;
+		memset(&R, 0, sizeof(R));
+		R.style = it->second;
+
+		switch (scene.type(s))
+		{
+		case ShapeType::Rect:    R.type = (uint8_t)RecordType::Rect; break;
+		case ShapeType::Segment: R.type = (uint8_t)RecordType::Seg;  break;
+		case ShapeType::Circle:  R.type = (uint8_t)RecordType::Circ; break;
+		default:                 R.type = (uint8_t)RecordType::Poly; break;
+		}
+
+		if (scene.type(s) == ShapeType::PolyLine)
+		{
+			const V2* pts = scene.points().data() + T.first[r];
+			points.push_back((int32_t)T.count[r]);
+			for (uint32_t i = 0; i < T.count[r]; ++i) { points.push_back(pts[i].x); points.push_back(pts[i].y); }
+			pointCount += T.count[r];
+		}
+		else
+		{
+			R.coords[0] = T.p1[r].x; R.coords[1] = T.p1[r].y;
+			R.coords[2] = T.p2[r].x; R.coords[3] = T.p2[r].y;
+		}
+		records.push_back(R);
+	}
+
+	FileHeader H;
+	memcpy(H.magic, MAGIC, 4);
+	H.version     = VERSION;
+	H.styleCount  = (uint32_t)styles.size();
+	H.objectCount = (uint32_t)records.size();
+	H.pointCount  = pointCount;
+
+	ofstream out(filename, ios::binary);
+	if (!out) return false;
+
+	out.write((const char*)&H, sizeof(H));
+	out.write((const char*)styles.data(),  styles.size()  * sizeof(StyleRecord));
+	out.write((const char*)records.data(), records.size() * sizeof(ObjectRecord));
+	out.write((const char*)points.data(),  points.size()  * sizeof(int32_t));
+	return (bool)out;
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Load
+//
+/////////////////////////////////////////////////////////////
+
+bool loadBinaryScene(const string& filename, vector<shared_ptr<ObjGeom>>& objects)
+{
+	// whole file in a single read
+	ifstream in(filename, ios::binary | ios::ate);
+	if (!in) return false;
+	size_t fileSize = (size_t)in.tellg();
+	vector<char> buffer(fileSize);
+	in.seekg(0);
+	if (!in.read(buffer.data(), fileSize)) return false;
+
+	FileHeader H;
+	if (fileSize < sizeof(H)) return false;
+	memcpy(&H, buffer.data(), sizeof(H));
+
+	if (memcmp(H.magic, MAGIC, 4) != 0) { cout << "Not a scene file : " << filename << endl; return false; }
+	if (H.version > VERSION) { cout << "Unsupported scene file version " << H.version << endl; return false; }
+
+	size_t stylesBytes  = (size_t)H.styleCount  * sizeof(StyleRecord);
+	size_t recordsBytes = (size_t)H.objectCount * sizeof(ObjectRecord);
+	if (fileSize < sizeof(H) + stylesBytes + recordsBytes) { cout << "Truncated scene file" << endl; return false; }
+
+	const char* ptr = buffer.data() + sizeof(H);
+	vector<StyleRecord> styles(H.styleCount);
+	memcpy(styles.data(), ptr, stylesBytes);
+	ptr += stylesBytes;
+
+	vector<ObjAttr> attrs;
+	attrs.reserve(styles.size());
+	for (auto& S : styles) attrs.push_back(fromRecord(S));
+
+	const ObjectRecord* records = (const ObjectRecord*)ptr;
+	ptr += recordsBytes;
+	const char* end = buffer.data() + fileSize;
+
+	objects.reserve(objects.size() + H.objectCount);
+
+	for (uint32_t i = 0; i < H.objectCount; ++i)
+	{
+		ObjectRecord R;
+		memcpy(&R, &records[i], sizeof(R));
+		if (R.style >= attrs.size()) { cout << "Invalid style index in scene file" << endl; return false; }
+
+		const ObjAttr& A = attrs[R.style];
+		V2 P1(R.coords[0], R.coords[1]);
+		V2 P2(R.coords[2], R.coords[3]);
+
+		switch ((RecordType)R.type)
+		{
+		case RecordType::Rect: objects.push_back(makeObject<ObjRectangle>(A, P1, P2)); break;
+		case RecordType::Seg:  objects.push_back(makeObject<ObjSegment>(A, P1, P2));   break;
+		case RecordType::Circ: objects.push_back(makeObject<ObjCircle>(A, P1, P2));    break;
+		case RecordType::Poly:
+		{
+			int32_t n;
+			if (end - ptr < (ptrdiff_t)sizeof(n)) { cout << "Truncated scene file" << endl; return false; }
+			memcpy(&n, ptr, sizeof(n));
+			ptr += sizeof(n);
+			if (n < 0 || end - ptr < (ptrdiff_t)n * 2 * (ptrdiff_t)sizeof(int32_t)) { cout << "Truncated scene file" << endl; return false; }
+
+			vector<V2> pts(n);
+			const int32_t* xy = (const int32_t*)ptr;
+			for (int32_t k = 0; k < n; ++k)
+			{
+				int32_t p[2];
+				memcpy(p, xy + 2 * k, sizeof(p));
+				pts[k] = V2(p[0], p[1]);
+			}
+			ptr += (size_t)n * 2 * sizeof(int32_t);
+			objects.push_back(makeObject<ObjPolyLine>(A, pts));
+			break;
+		}
+		default:
+			cout << "Unknown object type " << (int)R.type << " in scene file" << endl;
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,26 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "ObjGeom.h"
+#include "SceneStore.h"
+
+// binary scene file (.pbin), the text format (.txt) stays available for interchange
+//
+//   header  : magic "PSCN", version, number of styles / objects / polyline points
+//   styles  : table of the distinct ObjAttr, fixed-size records
+//   objects : fixed-size records (type, style index, 4 ints)
+//             RECT / SEG / CIRC store P1 P2, POLY stores nothing more
+//   points  : for each POLY, in object order : point count followed by the points
+//
+// integers and floats are stored little-endian, as in memory on x86
+
+bool isBinarySceneFile(const std::string& filename);
+
+// written from the arrays of the store, in drawing order
+bool saveBinaryScene(const std::string& filename, const SceneStore& scene);
+
+// objects are appended to the list, returns false if the file is missing or invalid
+bool loadBinaryScene(const std::string& filename, std::vector<std::shared_ptr<ObjGeom>>& objects);
@@ -0,0 +1,124 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+
+#include "SceneRenderer.h"
+
+// visible depth range of the camera (glOrtho near -1 far 10) : z in ]-10, 1[
+static const float Zback  = -9.5f;
+static const float Zrange = 10.0f;
+
+void SceneRenderer::rebuild(const Model& D, V2 view)
+{
+	const SceneStore& S = D.store();
+	meshes_.resize(S.slotCount());
+	lastRebuilt_ = 0;
+
+	visible_.clear();
+	D.slotsInRegion(V2(0, 0), view, visible_);
+	culled_ = (int)(S.size() - visible_.size());
+
+	// same objects in the same order : the z levels and the ranges of the last merge are still valid
+	bool inPlace = built_ && view_ == view && visible_ == merged_;
+	patches_.clear();
+
+	// tessellate the new or modified objects (versions are unique, even when a slot is reused)
+	for (uint32_t s : visible_)
+	{
+		Mesh& M = meshes_[s];
+		if (M.version == S.version(s)) continue;
+
+		size_t nbFill = M.fill.size(), nbLines = M.lines.size();
+		int thickness = M.thickness;
+
+		M.version   = S.version(s);
+		M.thickness = S.shapes(S.type(s)).attr[S.row(s)].thickness_;
+		M.fill.clear();
+		M.lines.clear();
+		SceneStore::Tessellator T = { M.fill, M.lines };
+		S.visit(s, T);
+		lastRebuilt_++;
+
+		if (M.fill.size() == nbFill && M.lines.size() == nbLines && M.thickness == thickness) patches_.push_back(s);
+		else inPlace = false;
+	}
+
+	// forget the deleted ones, a slot already reused keeps its mesh until it is tessellated again
+	removed_.clear();
+	if (store_ == &S && S.removedSince(removals_, removed_))
+	{
+		for (uint32_t s : removed_)
+			if (!S.used(s)) meshes_[s] = Mesh();
+	}
+	else
+	{
+		// other store, or too many removals : whole sweep
+		for (uint32_t s = 0; s < meshes_.size(); ++s)
+			if (!S.used(s) && meshes_[s].version != 0) meshes_[s] = Mesh();
+	}
+	store_    = &S;
+	removals_ = S.removals();
+
+	if (inPlace)
+		for (uint32_t s : patches_) patch(s);
+	else merge();
+	lastMerged_ = !inPlace;
+
+	revision_ = D.revision();
+	view_ = view;
+	built_ = true;
+}
+
+// merge in drawing order : 2 z levels per object, the fill below the border
+void SceneRenderer::merge()
+{
+	triangles_.clear();
+	for (auto& L : linesByThickness_) L.second.clear();
+
+	step_ = Zrange / (2 * visible_.size() + 1);
+	float z = Zback;
+
+	for (uint32_t s : visible_)
+	{
+		Mesh& M = meshes_[s];
+
+		z += step_;
+		M.z = z;
+		M.fillAt = triangles_.size();
+		for (GVertex v : M.fill) { v.z = z; triangles_.push_back(v); }
+
+		z += step_;
+		vector<GVertex>& lines = linesByThickness_[M.thickness];
+		M.linesAt = lines.size();
+		for (GVertex v : M.lines) { v.z = z; lines.push_back(v); }
+	}
+
+	for (auto it = linesByThickness_.begin(); it != linesByThickness_.end(); )
+		if (it->second.empty()) it = linesByThickness_.erase(it);
+		else ++it;
+
+	merged_ = visible_;
+}
+
+// the mesh has the vertex counts and the thickness of the merged one
+void SceneRenderer::patch(uint32_t s)
+{
+	const Mesh& M = meshes_[s];
+
+	GVertex* fill = triangles_.data() + M.fillAt;
+	for (size_t i = 0; i < M.fill.size(); ++i) { fill[i] = M.fill[i]; fill[i].z = M.z; }
+
+	if (M.lines.empty()) return;
+	GVertex* lines = linesByThickness_[M.thickness].data() + M.linesAt;
+	for (size_t i = 0; i < M.lines.size(); ++i) { lines[i] = M.lines[i]; lines[i].z = M.z + step_; }
+}
+
+void SceneRenderer::draw(Graphics& G, const Model& D)
+{
+	V2 view = G.getWindowSize();
+	if (!built_ || revision_ != D.revision() || !(view_ == view))
+		rebuild(D, view);
+
+	G.drawTriangles(triangles_);
+
+	for (auto& L : linesByThickness_)
+		G.drawLines(L.second, L.first);
+}
@@ -0,0 +1,83 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <vector>
+#include <map>
+#include "Graphics.h"
+#include "Model.h"
+
+using namespace std;
+
+// retained rendering of the scene objects
+//
+// each object is tessellated once (ObjGeom::tessellate) and its vertices are cached,
+// by slot of the SceneStore, until its version_ changes. The cached vertices of the whole scene are merged into
+// one triangle list and one line list per thickness, so the scene costs a few draw
+// calls per frame. The drawing order is kept with the depth buffer : every object
+// gets a z level above the objects drawn before it.
+//
+// only the objects crossing the window enter the lists : they are found with the
+// spatial index, the objects outside are neither tessellated nor merged nor drawn.
+//
+// each object keeps its range in the merged lists : when the same objects cross the
+// window and a modified one has as many vertices as before (a dragged point, a new
+// color), its range is overwritten in place instead of merging the whole scene again.
+
+class SceneRenderer
+{
+	struct Mesh
+	{
+		unsigned long long version = 0;
+		int thickness = 1;
+		vector<GVertex> fill;
+		vector<GVertex> lines;
+
+		// place in triangles_ and linesByThickness_[thickness] at the last merge
+		size_t fillAt  = 0;
+		size_t linesAt = 0;
+		float  z       = 0;   // of the fill, the lines are one step above
+	};
+
+	vector<Mesh> meshes_;   // by store slot
+
+	// meshes of the removed objects are dropped from the removal log of the store
+	const SceneStore*  store_    = nullptr;
+	unsigned long long removals_ = 0;
+	vector<uint32_t>   removed_;
+
+	// merged lists, rebuilt when the scene revision or the window size changes
+	unsigned long long revision_ = 0;
+	V2                 view_;
+	bool               built_    = false;
+	vector<uint32_t>   visible_;   // slots crossing the window, in drawing order
+	vector<uint32_t>   merged_;    // visible_ of the last merge
+	vector<uint32_t>   patches_;   // slots to overwrite in place
+	vector<GVertex>    triangles_;
+	map<int, vector<GVertex>> linesByThickness_;
+	float              step_ = 0;  // between two z levels
+
+	int lastRebuilt_ = 0;
+	int culled_      = 0;
+	bool lastMerged_ = false;
+
+	void rebuild(const Model& D, V2 view);
+	void merge();
+	void patch(uint32_t s);
+
+public:
+
+	void draw(Graphics& G, const Model& D);
+
+	// number of objects tessellated again by the last rebuild
+	int lastRebuilt() const { return lastRebuilt_; }
+
+	// false when the last rebuild only overwrote the ranges of the modified objects
+	bool lastMerged() const { return lastMerged_; }
+
+	// objects in the lists, objects left out because outside the window
+	int drawn()  const { return (int)visible_.size(); }
+	int culled() const { return culled_; }
+
+	// number of draw calls issued by draw()
+	int drawCalls() const { return (triangles_.empty() ? 0 : 1) + (int)linesByThickness_.size(); }
+};
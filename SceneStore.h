@@ -0,0 +1,401 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cstdint>
+#include "V2.h"
+#include "ObjAttr.h"
+#include "ObjGeom.h"
+
+using namespace std;
+
+// copy of the scene in contiguous arrays, maintained by Model
+//
+// each shape type has its own arrays (points, attributes, boxes), one row per object,
+// so the loops over the scene (pick, drawing, binary save) read packed data instead of
+// following a pointer per object. An object is reached through a stable slot : its
+// row moves when another object of the same type is removed, its slot does not.
+// The ObjGeom objects stay the reference used by the tools and the undo history.
+
+enum class ShapeType : uint8_t { Rect, Segment, Circle, PolyLine, Count };
+
+class SceneStore
+{
+public:
+
+	struct Box { int x0, y0, x1, y1; };   // drawn and picked area, see Model::indexObject
+
+	// one array per field, same row in all of them
+	struct Shapes
+	{
+		vector<V2>       p1, p2;          // RECT SEG CIRC
+		vector<uint32_t> first, count;    // POLY : range in points()
+		vector<ObjAttr>  attr;
+		vector<Box>      box;
+		vector<uint32_t> slot;
+
+		size_t size() const { return slot.size(); }
+	};
+
+	// typed views of a row, given to the visitors
+	struct RectRef     { const V2& P1; const V2& P2; const ObjAttr& attr; };
+	struct SegmentRef  { const V2& P1; const V2& P2; const ObjAttr& attr; };
+	struct CircleRef   { const V2& C;  const V2& P2; const ObjAttr& attr; };
+	struct PolyLineRef { const V2* pts; size_t n;    const ObjAttr& attr; };
+
+	typedef multimap<long long, uint32_t> Order;   // z -> slot
+
+private:
+	struct Slot
+	{
+		uint32_t  generation = 0;
+		bool      used       = false;
+		ShapeType type       = ShapeType::Rect;
+		uint32_t  row        = 0;
+		long long z          = 0;
+		unsigned long long version = 0;   // ObjGeom::version_ at the last update
+		ObjGeom*  obj        = nullptr;
+		Order::iterator pos;              // place in order_
+	};
+
+	Shapes           shapes_[(int)ShapeType::Count];
+	vector<V2>       points_;
+	size_t           deadPoints_ = 0;     // points of removed or resized polylines
+	vector<Slot>     slots_;
+	vector<uint32_t> free_;
+	Order            order_;              // drawing order, O(log n) to insert, move or remove
+	size_t           count_ = 0;
+
+	// removed slots, in order, for the caches kept by slot (SceneRenderer)
+	// removals_ counts them all, the oldest ones leave the log
+	vector<uint32_t>   removed_;
+	unsigned long long removals_ = 0;
+
+	void logRemoval(uint32_t s)
+	{
+		removed_.push_back(s);
+		removals_++;
+		if (removed_.size() > 4096 && removed_.size() > 2 * slots_.size())
+			removed_.erase(removed_.begin(), removed_.begin() + removed_.size() / 2);
+	}
+
+	static ShapeType typeOf(const ObjGeom* obj)
+	{
+		if (dynamic_cast<const ObjRectangle*>(obj)) return ShapeType::Rect;
+		if (dynamic_cast<const ObjSegment*>(obj))   return ShapeType::Segment;
+		if (dynamic_cast<const ObjCircle*>(obj))    return ShapeType::Circle;
+		if (dynamic_cast<const ObjPolyLine*>(obj))  return ShapeType::PolyLine;
+		return ShapeType::Count;
+	}
+
+	// copy the geometry and the attributes of the object into its row
+	void write(Slot& S, const Box& box)
+	{
+		Shapes& T = shapes_[(int)S.type];
+		uint32_t r = S.row;
+		T.attr[r] = S.obj->drawInfo_;
+		T.box[r]  = box;
+		S.version = S.obj->version_;
+
+		switch (S.type)
+		{
+		case ShapeType::Rect:    { auto o = (ObjRectangle*)S.obj; T.p1[r] = o->P1_; T.p2[r] = o->P2_; break; }
+		case ShapeType::Segment: { auto o = (ObjSegment*)S.obj;   T.p1[r] = o->P1_; T.p2[r] = o->P2_; break; }
+		case ShapeType::Circle:  { auto o = (ObjCircle*)S.obj;    T.p1[r] = o->P1_; T.p2[r] = o->P2_; break; }
+		case ShapeType::PolyLine:
+		{
+			const vector<V2>& pts = ((ObjPolyLine*)S.obj)->getPoints();
+			if (T.count[r] != pts.size())
+			{
+				// new range at the end, the old one is reclaimed by compact()
+				deadPoints_ += T.count[r];
+				T.first[r] = (uint32_t)points_.size();
+				T.count[r] = (uint32_t)pts.size();
+				points_.insert(points_.end(), pts.begin(), pts.end());
+				compact();
+			}
+			else copy(pts.begin(), pts.end(), points_.begin() + T.first[r]);
+			break;
+		}
+		default: break;
+		}
+	}
+
+	void compact()
+	{
+		if (deadPoints_ < 1024 || deadPoints_ * 2 < points_.size()) return;
+
+		Shapes& T = shapes_[(int)ShapeType::PolyLine];
+		vector<V2> packed;
+		packed.reserve(points_.size() - deadPoints_);
+		for (size_t r = 0; r < T.size(); ++r)
+		{
+			uint32_t first = (uint32_t)packed.size();
+			packed.insert(packed.end(), points_.begin() + T.first[r], points_.begin() + T.first[r] + T.count[r]);
+			T.first[r] = first;
+		}
+		points_.swap(packed);
+		deadPoints_ = 0;
+	}
+
+public:
+
+	size_t size() const { return count_; }
+
+	bool valid(Handle h) const
+	{
+		return h.index < slots_.size() && slots_[h.index].used && slots_[h.index].generation == h.generation;
+	}
+
+	// the object must not be in the store yet, its zOrder_ gives its drawing position
+	Handle add(ObjGeom* obj, const Box& box)
+	{
+		ShapeType type = typeOf(obj);
+		if (type == ShapeType::Count) return Handle();
+
+		uint32_t s;
+		if (!free_.empty()) { s = free_.back(); free_.pop_back(); }
+		else { s = (uint32_t)slots_.size(); slots_.push_back(Slot()); }
+
+		Slot& S = slots_[s];
+		S.used = true;
+		S.type = type;
+		S.obj  = obj;
+		S.z    = obj->zOrder_;
+
+		Shapes& T = shapes_[(int)type];
+		S.row = (uint32_t)T.size();
+		T.p1.push_back(V2());
+		T.p2.push_back(V2());
+		T.first.push_back(0);
+		T.count.push_back(0);
+		T.attr.push_back(ObjAttr());
+		T.box.push_back(box);
+		T.slot.push_back(s);
+		write(S, box);
+
+		S.pos = order_.emplace(S.z, s);
+		count_++;
+
+		Handle h;
+		h.index = s;
+		h.generation = S.generation;
+		return h;
+	}
+
+	// after a modification of the geometry or of the attributes
+	void update(Handle h, const Box& box)
+	{
+		if (valid(h)) write(slots_[h.index], box);
+	}
+
+	// after setControlPoint(i, p) : only the moved point and the box are written,
+	// update() copies every point of a polyline
+	void setPoint(Handle h, uint32_t i, const V2& p, const Box& box)
+	{
+		if (!valid(h)) return;
+		Slot& S = slots_[h.index];
+		Shapes& T = shapes_[(int)S.type];
+		uint32_t r = S.row;
+		if (S.type == ShapeType::PolyLine)
+		{
+			if (i >= T.count[r]) return;
+			points_[T.first[r] + i] = p;
+		}
+		else if (i == 0) T.p1[r] = p;
+		else if (i == 1) T.p2[r] = p;
+		else return;
+		T.box[r]  = box;
+		S.version = S.obj->version_;
+	}
+
+	void remove(Handle h)
+	{
+		if (!valid(h)) return;
+		uint32_t s = h.index;
+		Slot& S = slots_[s];
+
+		order_.erase(S.pos);
+
+		// the last row takes the place of the removed one
+		Shapes& T = shapes_[(int)S.type];
+		uint32_t r = S.row, last = (uint32_t)T.size() - 1;
+		deadPoints_ += T.count[r];
+		if (r != last)
+		{
+			T.p1[r] = T.p1[last];   T.p2[r] = T.p2[last];
+			T.first[r] = T.first[last]; T.count[r] = T.count[last];
+			T.attr[r] = T.attr[last];   T.box[r] = T.box[last];
+			T.slot[r] = T.slot[last];
+			slots_[T.slot[r]].row = r;
+		}
+		T.p1.pop_back(); T.p2.pop_back(); T.first.pop_back(); T.count.pop_back();
+		T.attr.pop_back(); T.box.pop_back(); T.slot.pop_back();
+		compact();
+
+		S.used = false;
+		S.obj  = nullptr;
+		S.generation++;
+		free_.push_back(s);
+		count_--;
+		logRemoval(s);
+	}
+
+	void setZ(Handle h, long long z)
+	{
+		if (!valid(h)) return;
+		Slot& S = slots_[h.index];
+		order_.erase(S.pos);
+		S.z   = z;
+		S.pos = order_.emplace(z, h.index);
+	}
+
+	// the handles given before stay invalid
+	void clear()
+	{
+		for (auto& T : shapes_) T = Shapes();
+		points_.clear();
+		deadPoints_ = 0;
+		order_.clear();
+		free_.clear();
+		for (uint32_t s = (uint32_t)slots_.size(); s-- > 0; )
+		{
+			if (slots_[s].used) { slots_[s].used = false; slots_[s].obj = nullptr; slots_[s].generation++; logRemoval(s); }
+			free_.push_back(s);
+		}
+		count_ = 0;
+	}
+
+	// access by slot, for the loops over order() or the spatial index results
+
+	// iterated from back to front, the slot is the value
+	const Order& order() const { return order_; }
+
+	bool       used(uint32_t s)    const { return slots_[s].used; }
+	ShapeType  type(uint32_t s)    const { return slots_[s].type; }
+	uint32_t   row(uint32_t s)     const { return slots_[s].row; }
+	long long  z(uint32_t s)       const { return slots_[s].z; }
+	unsigned long long version(uint32_t s) const { return slots_[s].version; }
+	uint32_t   generation(uint32_t s) const { return slots_[s].generation; }
+	ObjGeom*   object(uint32_t s)  const { return slots_[s].obj; }
+	const Box& box(uint32_t s)     const { return shapes_[(int)slots_[s].type].box[slots_[s].row]; }
+	size_t     slotCount()         const { return slots_.size(); }
+
+	// number of removals since the creation of the store
+	unsigned long long removals() const { return removals_; }
+
+	// slots removed after the first `since` removals, false if they have left the log
+	bool removedSince(unsigned long long since, vector<uint32_t>& out) const
+	{
+		if (since > removals_ || removals_ - since > removed_.size()) return false;
+		out.insert(out.end(), removed_.end() - (size_t)(removals_ - since), removed_.end());
+		return true;
+	}
+
+	const Shapes&     shapes(ShapeType t) const { return shapes_[(int)t]; }
+	const vector<V2>& points()            const { return points_; }
+
+	// visitors : a struct with one operator() per view type, resolved at compile time
+	//
+	//   visit(s, v)   : one slot, a switch on its type then a direct call
+	//   visitAll(v)   : every row, type by type, without dispatch in the loops
+
+	template <class Visitor>
+	void visit(uint32_t s, Visitor& v) const
+	{
+		const Slot& S = slots_[s];
+		visitRow(S.type, S.row, v);
+	}
+
+	template <class Visitor>
+	void visitRow(ShapeType type, uint32_t r, Visitor& v) const
+	{
+		const Shapes& T = shapes_[(int)type];
+		switch (type)
+		{
+		case ShapeType::Rect:     v(RectRef{ T.p1[r], T.p2[r], T.attr[r] }); break;
+		case ShapeType::Segment:  v(SegmentRef{ T.p1[r], T.p2[r], T.attr[r] }); break;
+		case ShapeType::Circle:   v(CircleRef{ T.p1[r], T.p2[r], T.attr[r] }); break;
+		case ShapeType::PolyLine: v(PolyLineRef{ points_.data() + T.first[r], T.count[r], T.attr[r] }); break;
+		default: break;
+		}
+	}
+
+	template <class Visitor>
+	void visitAll(Visitor& v) const
+	{
+		const Shapes& R = shapes_[(int)ShapeType::Rect];
+		for (size_t r = 0; r < R.size(); ++r) v(RectRef{ R.p1[r], R.p2[r], R.attr[r] });
+
+		const Shapes& S = shapes_[(int)ShapeType::Segment];
+		for (size_t r = 0; r < S.size(); ++r) v(SegmentRef{ S.p1[r], S.p2[r], S.attr[r] });
+
+		const Shapes& C = shapes_[(int)ShapeType::Circle];
+		for (size_t r = 0; r < C.size(); ++r) v(CircleRef{ C.p1[r], C.p2[r], C.attr[r] });
+
+		const Shapes& P = shapes_[(int)ShapeType::PolyLine];
+		for (size_t r = 0; r < P.size(); ++r) v(PolyLineRef{ points_.data() + P.first[r], P.count[r], P.attr[r] });
+	}
+
+	// same points as ObjGeom::getControlPoints, as stored at the last update
+	void getControlPoints(uint32_t s, vector<V2>& out) const
+	{
+		const Slot& S = slots_[s];
+		const Shapes& T = shapes_[(int)S.type];
+		if (S.type == ShapeType::PolyLine)
+			out.insert(out.end(), points_.begin() + T.first[S.row], points_.begin() + T.first[S.row] + T.count[S.row]);
+		else
+		{
+			out.push_back(T.p1[S.row]);
+			out.push_back(T.p2[S.row]);
+		}
+	}
+
+	// i-th point of getControlPoints, i must be valid
+	const V2& controlPoint(uint32_t s, uint32_t i) const
+	{
+		const Slot& S = slots_[s];
+		const Shapes& T = shapes_[(int)S.type];
+		if (S.type == ShapeType::PolyLine) return points_[T.first[S.row] + i];
+		return (i == 0) ? T.p1[S.row] : T.p2[S.row];
+	}
+
+	// vertices of a row, with the static tessellation of each shape (ObjGeom::tessellate)
+	struct Tessellator
+	{
+		vector<GVertex>& fill;
+		vector<GVertex>& lines;
+
+		void operator()(const RectRef& o)     { ObjRectangle::tessellate(o.attr, o.P1, o.P2, fill, lines); }
+		void operator()(const SegmentRef& o)  { ObjSegment::tessellate(o.attr, o.P1, o.P2, fill, lines); }
+		void operator()(const CircleRef& o)   { ObjCircle::tessellate(o.attr, o.C, o.P2, fill, lines); }
+		void operator()(const PolyLineRef& o) { ObjPolyLine::tessellate(o.attr, o.pts, o.n, fill, lines); }
+	};
+
+	// same answer as ObjGeom::contains, computed on the arrays
+	struct HitTest
+	{
+		V2   p;
+		bool result = false;
+
+		void operator()(const RectRef& o)     { result = ObjRectangle::hit(o.P1, o.P2, p); }
+		void operator()(const SegmentRef& o)  { result = ObjSegment::hit(o.P1, o.P2, o.attr.thickness_, p); }
+		void operator()(const CircleRef& o)   { result = ObjCircle::hit(o.C, o.P2, p); }
+		void operator()(const PolyLineRef& o) { result = ObjPolyLine::hit(o.pts, o.n, p); }
+	};
+
+	bool contains(uint32_t s, const V2& p) const
+	{
+		// long polylines : the object keeps boxes over its segments
+		const Slot& S = slots_[s];
+		if (S.type == ShapeType::PolyLine && shapes_[(int)S.type].count[S.row] > ObjPolyLine::LinearMax)
+			return S.obj->contains(p);
+
+		HitTest H;
+		H.p = p;
+		visit(s, H);
+		return H.result;
+	}
+};
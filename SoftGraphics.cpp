@@ -0,0 +1,325 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include "SoftGraphics.h"
+#include "CircleTable.h"
+
+// image decoding, in texture.cpp
+bool LoadImageRGBA(const std::string& filename, std::vector<unsigned char>& rgba, int& w, int& h);
+
+static const float NoDepth = -1e30f;
+
+SoftGraphics::SoftGraphics(int width, int height) : W_(width), H_(height)
+{
+	pixels_.assign((size_t)W_ * H_ * 4, 0);
+	depth_.assign((size_t)W_ * H_, NoDepth);
+	resetClip();
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Pixels
+//
+/////////////////////////////////////////////////////////////
+
+static unsigned char ToByte(float v)
+{
+	if (v <= 0) return 0;
+	if (v >= 1) return 255;
+	return (unsigned char)(v * 255 + 0.5f);
+}
+
+void SoftGraphics::plot(int x, int y, const Color& c)
+{
+	if (x < clipX0_ || x >= clipX1_ || y < clipY0_ || y >= clipY1_) return;
+
+	unsigned char* p = &pixels_[((size_t)y * W_ + x) * 4];
+	if (c.A >= 1)
+	{
+		p[0] = ToByte(c.R); p[1] = ToByte(c.G); p[2] = ToByte(c.B); p[3] = 255;
+		return;
+	}
+
+	// blending as in GL : src * alpha + dst * (1 - alpha)
+	float a = max(0.0f, c.A);
+	p[0] = ToByte(c.R * a + p[0] / 255.0f * (1 - a));
+	p[1] = ToByte(c.G * a + p[1] / 255.0f * (1 - a));
+	p[2] = ToByte(c.B * a + p[2] / 255.0f * (1 - a));
+	p[3] = ToByte(a + p[3] / 255.0f * (1 - a));
+}
+
+void SoftGraphics::plotDepth(int x, int y, const Color& c, float z)
+{
+	if (x < clipX0_ || x >= clipX1_ || y < clipY0_ || y >= clipY1_) return;
+
+	float& d = depth_[(size_t)y * W_ + x];
+	if (z < d) return;    // GL_LEQUAL with a camera looking down -z
+	d = z;
+	plot(x, y, c);
+}
+
+void SoftGraphics::clearWindow(Color c)
+{
+	unsigned char r = ToByte(c.R), g = ToByte(c.G), b = ToByte(c.B), a = ToByte(c.A);
+
+	for (int y = clipY0_; y < clipY1_; ++y)
+		for (int x = clipX0_; x < clipX1_; ++x)
+		{
+			unsigned char* p = &pixels_[((size_t)y * W_ + x) * 4];
+			p[0] = r; p[1] = g; p[2] = b; p[3] = a;
+			depth_[(size_t)y * W_ + x] = NoDepth;
+		}
+}
+
+void SoftGraphics::setPixel(V2 P, Color c)
+{
+	plot(P.x, P.y, c);
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Frame cache / clipping
+//
+/////////////////////////////////////////////////////////////
+
+void SoftGraphics::saveFrame(V2 P, V2 size, FrameLayer layer)
+{
+	vector<unsigned char>& frame = frames_[(int)layer];
+	if (frame.size() != pixels_.size()) frame = pixels_;
+
+	int x0 = max(0, P.x), y0 = max(0, P.y);
+	int x1 = min(W_, P.x + size.x), y1 = min(H_, P.y + size.y);
+
+	for (int y = y0; y < y1; ++y)
+	{
+		size_t offset = ((size_t)y * W_ + x0) * 4;
+		copy(pixels_.begin() + offset, pixels_.begin() + offset + (x1 - x0) * 4, frame.begin() + offset);
+	}
+}
+
+void SoftGraphics::restoreFrame(FrameLayer layer)
+{
+	const vector<unsigned char>& frame = frames_[(int)layer];
+	if (frame.size() == pixels_.size()) pixels_ = frame;
+}
+
+void SoftGraphics::setClip(V2 P, V2 size)
+{
+	clipX0_ = max(0, P.x);
+	clipY0_ = max(0, P.y);
+	clipX1_ = min(W_, P.x + size.x);
+	clipY1_ = min(H_, P.y + size.y);
+}
+
+void SoftGraphics::resetClip()
+{
+	clipX0_ = clipY0_ = 0;
+	clipX1_ = W_;
+	clipY1_ = H_;
+}
+
+void SoftGraphics::getClip(V2& P, V2& size)
+{
+	P = V2(clipX0_, clipY0_);
+	size = V2(clipX1_ - clipX0_, clipY1_ - clipY0_);
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Rasterization
+//
+/////////////////////////////////////////////////////////////
+
+void SoftGraphics::fillPolygon(const vector<float>& X, const vector<float>& Y, const Color& c, bool useDepth, float z)
+{
+	if (useDepth) rasterPolygon(X.data(), Y.data(), X.size(), clip(), cross_, [&](int x, int y) { plotDepth(x, y, c, z); });
+	else          rasterPolygon(X.data(), Y.data(), X.size(), clip(), cross_, [&](int x, int y) { plot(x, y, c); });
+}
+
+void SoftGraphics::line(float x1, float y1, float x2, float y2, const Color& c, int thickness, bool useDepth, float z)
+{
+	if (useDepth) rasterLine(x1, y1, x2, y2, thickness, clip(), cross_, [&](int x, int y) { plotDepth(x, y, c, z); });
+	else          rasterLine(x1, y1, x2, y2, thickness, clip(), cross_, [&](int x, int y) { plot(x, y, c); });
+}
+
+void SoftGraphics::drawLine(V2 P1, V2 P2, Color c, int thickness)
+{
+	line((float)P1.x, (float)P1.y, (float)P2.x, (float)P2.y, c, thickness, false, 0);
+}
+
+void SoftGraphics::drawPolygon(vector<V2>& PointList, Color c, bool fill, int thickness)
+{
+	if (fill)
+	{
+		vector<float> X, Y;
+		for (V2 P : PointList) { X.push_back((float)P.x); Y.push_back((float)P.y); }
+		fillPolygon(X, Y, c, false, 0);
+		return;
+	}
+
+	for (size_t i = 0; i < PointList.size(); ++i)
+	{
+		V2 A = PointList[i], B = PointList[(i + 1) % PointList.size()];
+		drawLine(A, B, c, thickness);
+	}
+}
+
+void SoftGraphics::drawRectangle(V2 P1, V2 Size, Color c, bool fill, int thickness)
+{
+	V2 A = P1, B = P1 + V2(Size.x, 0), C = P1 + Size, D = P1 + V2(0, Size.y);
+
+	if (fill)
+	{
+		vector<float> X = { (float)A.x, (float)B.x, (float)C.x, (float)D.x };
+		vector<float> Y = { (float)A.y, (float)B.y, (float)C.y, (float)D.y };
+		fillPolygon(X, Y, c, false, 0);
+		return;
+	}
+
+	drawLine(A, B, c, thickness);
+	drawLine(B, C, c, thickness);
+	drawLine(C, D, c, thickness);
+	drawLine(D, A, c, thickness);
+}
+
+void SoftGraphics::drawCircle(V2 C, float r, Color c, bool fill, int thickness)
+{
+	circleX_.clear();
+	circleY_.clear();
+	circlePoints((float)C.x, (float)C.y, r, circleSides(r), [this](float x, float y) { circleX_.push_back(x); circleY_.push_back(y); });
+
+	if (fill)
+	{
+		fillPolygon(circleX_, circleY_, c, false, 0);
+		return;
+	}
+
+	for (size_t i = 0; i + 1 < circleX_.size(); ++i)
+		line(circleX_[i], circleY_[i], circleX_[i + 1], circleY_[i + 1], c, thickness, false, 0);
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Font
+//
+/////////////////////////////////////////////////////////////
+
+void SoftGraphics::drawString(V2 pos, const string& text, float fontSize, float thickness, const Color& c, StrokeFontId font)
+{
+	const vector<float>& xy = strokeTextSegments(font, text, fontSize);
+	for (size_t i = 0; i + 3 < xy.size(); i += 4)
+		line(pos.x + xy[i], pos.y + xy[i + 1], pos.x + xy[i + 2], pos.y + xy[i + 3], c, (int)thickness, false, 0);
+}
+
+void SoftGraphics::drawStringFontMono(V2 pos, string text, float fontSize, float thickness, Color c)
+{
+	drawString(pos, text, fontSize, thickness, c, StrokeFontId::MonoRoman);
+}
+
+void SoftGraphics::drawStringFontRoman(V2 pos, string text, float fontSize, float thickness, Color c)
+{
+	drawString(pos, text, fontSize, thickness, c, StrokeFontId::Roman);
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Batches
+//
+/////////////////////////////////////////////////////////////
+
+// the batched meshes have one color and one z per primitive : the first vertex is used
+
+void SoftGraphics::drawTriangles(const vector<GVertex>& V)
+{
+	vector<float> X(3), Y(3);
+	for (size_t i = 0; i + 2 < V.size(); i += 3)
+	{
+		for (int k = 0; k < 3; ++k) { X[k] = V[i + k].x; Y[k] = V[i + k].y; }
+		Color c(V[i].R, V[i].G, V[i].B, V[i].A);
+		fillPolygon(X, Y, c, true, V[i].z);
+	}
+}
+
+void SoftGraphics::drawLines(const vector<GVertex>& V, int thickness)
+{
+	for (size_t i = 0; i + 1 < V.size(); i += 2)
+	{
+		Color c(V[i].R, V[i].G, V[i].B, V[i].A);
+		line(V[i].x, V[i].y, V[i + 1].x, V[i + 1].y, c, thickness, true, V[i].z);
+	}
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Sprites
+//
+/////////////////////////////////////////////////////////////
+
+const SoftGraphics::Image& SoftGraphics::getImage(const string& filename)
+{
+	auto it = images_.find(filename);
+	if (it != images_.end()) return it->second;
+
+	Image& I = images_[filename];
+	if (!LoadImageRGBA(filename, I.rgba, I.w, I.h))
+	{
+		I.w = I.h = 0;
+		I.rgba.clear();
+	}
+	return I;
+}
+
+void SoftGraphics::drawRectWithTexture(std::string filename, V2 pos, V2 size, float angleDeg)
+{
+	const Image& I = getImage(filename);
+
+	float w = (float)size.x, h = (float)size.y;
+	float cx = pos.x + w * 0.5f, cy = pos.y + h * 0.5f;
+	float a = angleDeg * 3.14159265f / 180;
+	float ca = cos(a), sa = sin(a);
+
+	// bounding box of the rotated rectangle
+	float ex = fabs(ca) * w * 0.5f + fabs(sa) * h * 0.5f;
+	float ey = fabs(sa) * w * 0.5f + fabs(ca) * h * 0.5f;
+	int x0 = max(clipX0_, (int)floor(cx - ex)), x1 = min(clipX1_ - 1, (int)ceil(cx + ex));
+	int y0 = max(clipY0_, (int)floor(cy - ey)), y1 = min(clipY1_ - 1, (int)ceil(cy + ey));
+
+	for (int y = y0; y <= y1; ++y)
+		for (int x = x0; x <= x1; ++x)
+		{
+			// back to the coordinates of the unrotated rectangle
+			float px = x + 0.5f - cx, py = y + 0.5f - cy;
+			float u = ( ca * px + sa * py) / w + 0.5f;
+			float v = (-sa * px + ca * py) / h + 0.5f;
+			if (u < 0 || u >= 1 || v < 0 || v >= 1) continue;
+
+			if (I.w == 0) { plot(x, y, Color::Magenta); continue; }   // texture error
+
+			int ix = (int)(u * I.w);
+			int iy = I.h - 1 - (int)(v * I.h);   // image stored from the top
+			const unsigned char* p = &I.rgba[((size_t)iy * I.w + ix) * 4];
+			plot(x, y, Color(p[0] / 255.0f, p[1] / 255.0f, p[2] / 255.0f, p[3] / 255.0f));
+		}
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Export
+//
+/////////////////////////////////////////////////////////////
+
+bool SoftGraphics::savePPM(const string& filename) const
+{
+	ofstream out(filename, ios::binary);
+	if (!out) return false;
+
+	out << "P6\n" << W_ << " " << H_ << "\n255\n";
+	for (int y = H_ - 1; y >= 0; --y)    // image file starts from the top
+		for (int x = 0; x < W_; ++x)
+			out.write((const char*)&pixels_[((size_t)y * W_ + x) * 4], 3);
+
+	return (bool)out;
+}
@@ -0,0 +1,80 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include "Graphics.h"
+#include "Raster.h"
+#include "StrokeFont.h"
+
+using namespace std;
+
+// software rasterizer : draws into an RGBA buffer in memory
+// used without window or GPU, for batch export and benchmarks
+// same axes as the GL window : origin at the bottom left corner, y up
+
+class SoftGraphics : public Graphics
+{
+	struct Image
+	{
+		int w = 0, h = 0;
+		vector<unsigned char> rgba;   // first row = top of the image
+	};
+
+	int W_, H_;
+	vector<unsigned char> pixels_;   // RGBA, first row = bottom of the window
+	vector<unsigned char> frames_[(int)FrameLayer::Count];   // frame cache
+	vector<float>         depth_;    // z of the batched geometry, higher = in front
+
+	int clipX0_, clipY0_, clipX1_, clipY1_;   // drawable pixels : x0 <= x < x1, y0 <= y < y1
+	vector<float> cross_;                     // scratch buffer of the scan conversion
+	vector<float> circleX_, circleY_;         // vertices of the last circle
+
+	RasterClip clip() const { return { clipX0_, clipY0_, clipX1_, clipY1_ }; }
+
+	map<string, Image> images_;
+
+	void plot(int x, int y, const Color& c);
+	void plotDepth(int x, int y, const Color& c, float z);
+
+	// see Raster.h, depth tested on z if useDepth
+	void fillPolygon(const vector<float>& X, const vector<float>& Y, const Color& c, bool useDepth, float z);
+	void line(float x1, float y1, float x2, float y2, const Color& c, int thickness, bool useDepth, float z);
+	void drawString(V2 pos, const string& text, float fontSize, float thickness, const Color& c, StrokeFontId font);
+
+	const Image& getImage(const string& filename);
+
+public:
+
+	SoftGraphics(int width, int height);
+
+	const vector<unsigned char>& getPixels() const { return pixels_; }
+
+	// binary PPM (P6), without alpha
+	bool savePPM(const string& filename) const;
+
+	V2   getWindowSize() override { return V2(W_, H_); }
+	void clearWindow(Color c) override;
+
+	void saveFrame(V2 P, V2 size, FrameLayer layer = FrameLayer::Frame) override;
+	void restoreFrame(FrameLayer layer = FrameLayer::Frame) override;
+	bool hasFrame(FrameLayer layer) override { return frames_[(int)layer].size() == pixels_.size(); }
+	void setClip(V2 P, V2 size) override;
+	void resetClip() override;
+	void getClip(V2& P, V2& size) override;
+
+	void drawStringFontMono(V2 pos, string text, float fontSize, float thickness, Color c) override;
+	void drawStringFontRoman(V2 pos, string text, float fontSize, float thickness, Color c) override;
+
+	void drawRectWithTexture(std::string filename, V2 pos, V2 size, float angleDeg) override;
+
+	void setPixel(V2 P, Color c) override;
+	void drawLine(V2 P1, V2 P2, Color c, int thickness) override;
+	void drawPolygon(vector<V2>& PointList, Color c, bool fill, int thickness) override;
+	void drawRectangle(V2 P1, V2 Size, Color c, bool fill, int thickness) override;
+	void drawCircle(V2 C, float r, Color c, bool fill, int thickness) override;
+
+	void drawTriangles(const vector<GVertex>& V) override;
+	void drawLines(const vector<GVertex>& V, int thickness) override;
+};
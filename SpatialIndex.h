@@ -0,0 +1,154 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include "V2.h"
+
+// uniform grid over the bounding boxes of the scene objects
+// a query only looks at the cell under the point, so a pick costs
+// the number of objects around the cursor instead of the scene size
+//
+// the objects are identified by small integers (slots of the SceneStore)
+
+class SpatialIndex
+{
+	struct Box
+	{
+		int x0, y0, x1, y1;   // inclusive bounds
+
+		bool contains(const V2& p) const { return p.x >= x0 && p.x <= x1 && p.y >= y0 && p.y <= y1; }
+		bool empty() const { return x0 > x1; }
+		bool intersects(const Box& b) const { return x0 <= b.x1 && b.x0 <= x1 && y0 <= b.y1 && b.y0 <= y1; }
+	};
+
+	struct Item
+	{
+		uint32_t id;
+		Box      box;
+	};
+
+	static const int CellSize = 64;        // pixels
+	static const int MaxCellsPerItem = 64; // bigger objects go in the oversized list
+
+	std::unordered_map<long long, std::vector<Item>> cells_;
+	std::vector<Item>                                large_;
+	std::vector<Box>                                 boxes_;  // by id, box used at insertion, needed to remove
+	size_t                                           count_ = 0;
+
+	static int cellOf(int v) { return (v >= 0) ? v / CellSize : -((-v + CellSize - 1) / CellSize); }
+	static long long key(int cx, int cy) { return ((long long)cx << 32) ^ (unsigned int)cy; }
+
+	static bool isLarge(const Box& b)
+	{
+		long long nx = cellOf(b.x1) - cellOf(b.x0) + 1;
+		long long ny = cellOf(b.y1) - cellOf(b.y0) + 1;
+		return nx * ny > MaxCellsPerItem;
+	}
+
+	static void eraseItem(std::vector<Item>& L, uint32_t id)
+	{
+		for (size_t i = 0; i < L.size(); ++i)
+			if (L[i].id == id)
+			{
+				L[i] = L.back();
+				L.pop_back();
+				return;
+			}
+	}
+
+public:
+
+	size_t size() const { return count_; }
+
+	// P/size : must include the area where the object can be picked, see ObjGeom::getPickBox
+	void insert(uint32_t id, V2 P, V2 size)
+	{
+		remove(id);
+		Box b = { P.x, P.y, P.x + size.x, P.y + size.y };
+		if (id >= boxes_.size()) boxes_.resize(id + 1, { 0, 0, -1, -1 });
+		boxes_[id] = b;
+		count_++;
+
+		if (isLarge(b)) { large_.push_back({ id, b }); return; }
+
+		for (int cx = cellOf(b.x0); cx <= cellOf(b.x1); ++cx)
+			for (int cy = cellOf(b.y0); cy <= cellOf(b.y1); ++cy)
+				cells_[key(cx, cy)].push_back({ id, b });
+	}
+
+	void remove(uint32_t id)
+	{
+		if (id >= boxes_.size() || boxes_[id].empty()) return;
+		Box b = boxes_[id];
+		boxes_[id] = { 0, 0, -1, -1 };
+		count_--;
+
+		if (isLarge(b)) { eraseItem(large_, id); return; }
+
+		for (int cx = cellOf(b.x0); cx <= cellOf(b.x1); ++cx)
+			for (int cy = cellOf(b.y0); cy <= cellOf(b.y1); ++cy)
+			{
+				auto c = cells_.find(key(cx, cy));
+				if (c == cells_.end()) continue;
+				eraseItem(c->second, id);
+				if (c->second.empty()) cells_.erase(c);
+			}
+	}
+
+	// box given at insertion
+	bool getBox(uint32_t id, V2& P, V2& size) const
+	{
+		if (id >= boxes_.size() || boxes_[id].empty()) return false;
+		const Box& b = boxes_[id];
+		P = V2(b.x0, b.y0);
+		size = V2(b.x1 - b.x0, b.y1 - b.y0);
+		return true;
+	}
+
+	void clear()
+	{
+		cells_.clear();
+		large_.clear();
+		boxes_.clear();
+		count_ = 0;
+	}
+
+	// objects whose box contains p, in no particular order
+	void query(const V2& p, std::vector<uint32_t>& out) const
+	{
+		auto c = cells_.find(key(cellOf(p.x), cellOf(p.y)));
+		if (c != cells_.end())
+			for (const Item& I : c->second)
+				if (I.box.contains(p)) out.push_back(I.id);
+
+		for (const Item& I : large_)
+			if (I.box.contains(p)) out.push_back(I.id);
+	}
+
+	// objects whose box intersects the region P/size, each one once, in no particular order
+	void queryRegion(V2 P, V2 size, std::vector<uint32_t>& out) const
+	{
+		Box r = { P.x, P.y, P.x + size.x, P.y + size.y };
+		int cx0 = cellOf(r.x0), cy0 = cellOf(r.y0);
+
+		for (int cx = cx0; cx <= cellOf(r.x1); ++cx)
+			for (int cy = cy0; cy <= cellOf(r.y1); ++cy)
+			{
+				auto c = cells_.find(key(cx, cy));
+				if (c == cells_.end()) continue;
+				for (const Item& I : c->second)
+				{
+					if (!I.box.intersects(r)) continue;
+					// an object in several cells is given by the first cell it shares with the region
+					if (cx == std::max(cx0, cellOf(I.box.x0)) && cy == std::max(cy0, cellOf(I.box.y0)))
+						out.push_back(I.id);
+				}
+			}
+
+		for (const Item& I : large_)
+			if (I.box.intersects(r)) out.push_back(I.id);
+	}
+};
\ No newline at end of file
@@ -0,0 +1,83 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+
+#include <unordered_map>
+#include <cstring>
+#include "StrokeFont.h"
+#include "StrokeFontData.h"
+
+// size of a glyph in font units, as scaled by the previous glutStrokeCharacter() code
+static const float FontUnits = 152.38f;
+
+// beyond, the cache is emptied (the profiler overlay makes new strings at every frame)
+static const size_t MaxCachedStrings = 512;
+
+namespace
+{
+	// segments of one glyph, in font units
+	struct GlyphSegments
+	{
+		float advance = 0;
+		vector<float> xy;
+	};
+
+	struct FontSegments
+	{
+		GlyphSegments glyphs[96];   // characters 32 to 127
+
+		FontSegments(const float* points, const unsigned char* strips, const StrokeGlyph* glyphs_)
+		{
+			for (int c = 0; c < 96; ++c)
+			{
+				GlyphSegments& G = glyphs[c];
+				G.advance = glyphs_[c].advance;
+
+				for (int s = 0; s < glyphs_[c].nbStrips; ++s)
+				{
+					int n = *strips++;
+					for (int i = 0; i + 1 < n; ++i)
+						G.xy.insert(G.xy.end(), { points[2 * i], points[2 * i + 1], points[2 * i + 2], points[2 * i + 3] });
+					points += 2 * n;
+				}
+			}
+		}
+	};
+
+	const FontSegments& fontSegments(StrokeFontId font)
+	{
+		static const FontSegments Roman(RomanPoints, RomanStrips, RomanGlyphs);
+		static const FontSegments MonoRoman(MonoRomanPoints, MonoRomanStrips, MonoRomanGlyphs);
+		return (font == StrokeFontId::MonoRoman) ? MonoRoman : Roman;
+	}
+}
+
+const vector<float>& strokeTextSegments(StrokeFontId font, const string& text, float fontSize)
+{
+	static unordered_map<string, vector<float>> cache;
+
+	// key : font, size, text
+	string key(1 + sizeof(float), (char)font);
+	memcpy(&key[1], &fontSize, sizeof(float));
+	key += text;
+
+	auto it = cache.find(key);
+	if (it != cache.end()) return it->second;
+
+	if (cache.size() >= MaxCachedStrings) cache.clear();
+	vector<float>& xy = cache[key];
+
+	// characters without glyph are skipped, as glutStrokeCharacter() did
+	const FontSegments& F = fontSegments(font);
+	float scale = fontSize / FontUnits, x = 0;
+	for (unsigned char c : text)
+	{
+		if (c < 32 || c > 127) continue;
+		const GlyphSegments& G = F.glyphs[c - 32];
+		for (size_t i = 0; i < G.xy.size(); i += 2)
+		{
+			xy.push_back((x + G.xy[i]) * scale);
+			xy.push_back(G.xy[i + 1] * scale);
+		}
+		x += G.advance;
+	}
+	return xy;
+}
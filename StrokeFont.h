@@ -0,0 +1,20 @@
+/* Copyright (c) 2024 Lilian Buzer - All rights reserved - */
+#pragma once
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// text drawn with the stroke fonts of GLUT, built in (StrokeFontData.h) so that every
+// backend draws the same text, SoftGraphics included
+//
+// the polylines of each glyph are converted once into a list of segments. The segments of
+// a whole string, scaled to its size, are kept in a cache keyed by (font, size, text) : a
+// text that does not change from a frame to the next is drawn from a single vertex list.
+
+enum class StrokeFontId { Roman, MonoRoman, Count };
+
+// segments of the text drawn from (0, 0) with glyphs of fontSize pixels, in pixels
+// 2 points (x, y) per segment, the reference stays valid until the next call
+const vector<float>& strokeTextSegments(StrokeFontId font, const string& text, float fontSize);
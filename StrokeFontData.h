@@ -0,0 +1,1005 @@
+/*
+ * Glyph data of the freeglut stroke fonts (fg_stroke_roman.c, fg_stroke_mono_roman.c)
+ *
+ * Copyright (c) 1999-2000 Pawel W. Olszta. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies or substantial portions of the Software.
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * PAWEL W. OLSZTA BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of Pawel W. Olszta shall not
+ * be used in advertising or otherwise to promote the sale, use or other
+ * dealings in this Software without prior written authorization from Pawel
+ * W. Olszta.
+ */
+#pragma once
+
+// the freeglut arrays rearranged, the coordinates are unchanged
+//
+// only included by StrokeFont.cpp. For each font :
+//   Points : the polylines of the characters 33 to 127, one after the other (x, y)
+//   Strips : number of points of each polyline
+//   Glyphs : advance and number of polylines of the characters 32 to 127
+
+struct StrokeGlyph
+{
+	float advance;
+	int   nbStrips;
+};
+
+static const float RomanPoints[] =
+{
+	// 33 !
+	13.3819f,100, 13.3819f,33.3333f,
+	13.3819f,9.5238f, 8.62f,4.7619f, 13.3819f,0, 18.1438f,4.7619f, 13.3819f,9.5238f,
+	// 34 "
+	4.02f,100, 4.02f,66.6667f,
+	42.1152f,100, 42.1152f,66.6667f,
+	// 35 #
+	41.2952f,119.048f, 7.9619f,-33.3333f,
+	69.8667f,119.048f, 36.5333f,-33.3333f,
+	7.9619f,57.1429f, 74.6286f,57.1429f,
+	3.2f,28.5714f, 69.8667f,28.5714f,
+	// 36 $
+	28.6295f,119.048f, 28.6295f,-19.0476f,
+	47.6771f,119.048f, 47.6771f,-19.0476f,
+	71.4867f,85.7143f, 61.9629f,95.2381f, 47.6771f,100, 28.6295f,100, 14.3438f,95.2381f, 4.82f,85.7143f, 4.82f,76.1905f, 9.5819f,66.6667f,
+	14.3438f,61.9048f, 23.8676f,57.1429f, 52.439f,47.619f, 61.9629f,42.8571f, 66.7248f,38.0952f, 71.4867f,28.5714f, 71.4867f,14.2857f, 61.9629f,4.7619f,
+	47.6771f,0, 28.6295f,0, 14.3438f,4.7619f, 4.82f,14.2857f,
+	// 37 %
+	92.0743f,100, 6.36f,0,
+	30.1695f,100, 39.6933f,90.4762f, 39.6933f,80.9524f, 34.9314f,71.4286f, 25.4076f,66.6667f, 15.8838f,66.6667f, 6.36f,76.1905f, 6.36f,85.7143f,
+	11.1219f,95.2381f, 20.6457f,100, 30.1695f,100, 39.6933f,95.2381f, 53.979f,90.4762f, 68.2648f,90.4762f, 82.5505f,95.2381f, 92.0743f,100,
+	73.0267f,33.3333f, 63.5029f,28.5714f, 58.741f,19.0476f, 58.741f,9.5238f, 68.2648f,0, 77.7886f,0, 87.3124f,4.7619f, 92.0743f,14.2857f,
+	92.0743f,23.8095f, 82.5505f,33.3333f, 73.0267f,33.3333f,
+	// 38 &
+	101.218f,57.1429f, 101.218f,61.9048f, 96.4562f,66.6667f, 91.6943f,66.6667f, 86.9324f,61.9048f, 82.1705f,52.381f, 72.6467f,28.5714f, 63.1229f,14.2857f,
+	53.599f,4.7619f, 44.0752f,0, 25.0276f,0, 15.5038f,4.7619f, 10.7419f,9.5238f, 5.98f,19.0476f, 5.98f,28.5714f, 10.7419f,38.0952f,
+	15.5038f,42.8571f, 48.8371f,61.9048f, 53.599f,66.6667f, 58.361f,76.1905f, 58.361f,85.7143f, 53.599f,95.2381f, 44.0752f,100, 34.5514f,95.2381f,
+	29.7895f,85.7143f, 29.7895f,76.1905f, 34.5514f,61.9048f, 44.0752f,47.619f, 67.8848f,14.2857f, 77.4086f,4.7619f, 86.9324f,0, 96.4562f,0,
+	101.218f,4.7619f, 101.218f,9.5238f,
+	// 39 '
+	4.44f,100, 4.44f,66.6667f,
+	// 40 (
+	40.9133f,119.048f, 31.3895f,109.524f, 21.8657f,95.2381f, 12.3419f,76.1905f, 7.58f,52.381f, 7.58f,33.3333f, 12.3419f,9.5238f, 21.8657f,-9.5238f,
+	31.3895f,-23.8095f, 40.9133f,-33.3333f,
+	// 41 )
+	5.28f,119.048f, 14.8038f,109.524f, 24.3276f,95.2381f, 33.8514f,76.1905f, 38.6133f,52.381f, 38.6133f,33.3333f, 33.8514f,9.5238f, 24.3276f,-9.5238f,
+	14.8038f,-23.8095f, 5.28f,-33.3333f,
+	// 42 *
+	30.7695f,71.4286f, 30.7695f,14.2857f,
+	6.96f,57.1429f, 54.579f,28.5714f,
+	54.579f,57.1429f, 6.96f,28.5714f,
+	// 43 +
+	48.8371f,85.7143f, 48.8371f,0,
+	5.98f,42.8571f, 91.6943f,42.8571f,
+	// 44 ,
+	18.2838f,4.7619f, 13.5219f,0, 8.76f,4.7619f, 13.5219f,9.5238f, 18.2838f,4.7619f, 18.2838f,-4.7619f, 13.5219f,-14.2857f, 8.76f,-19.0476f,
+	// 45 -
+	7.38f,42.8571f, 93.0943f,42.8571f,
+	// 46 .
+	13.1019f,9.5238f, 8.34f,4.7619f, 13.1019f,0, 17.8638f,4.7619f, 13.1019f,9.5238f,
+	// 47 /
+	7.24f,-14.2857f, 73.9067f,100,
+	// 48 0
+	33.5514f,100, 19.2657f,95.2381f, 9.7419f,80.9524f, 4.98f,57.1429f, 4.98f,42.8571f, 9.7419f,19.0476f, 19.2657f,4.7619f, 33.5514f,0,
+	43.0752f,0, 57.361f,4.7619f, 66.8848f,19.0476f, 71.6467f,42.8571f, 71.6467f,57.1429f, 66.8848f,80.9524f, 57.361f,95.2381f, 43.0752f,100,
+	33.5514f,100,
+	// 49 1
+	11.82f,80.9524f, 21.3438f,85.7143f, 35.6295f,100, 35.6295f,0,
+	// 50 2
+	10.1819f,76.1905f, 10.1819f,80.9524f, 14.9438f,90.4762f, 19.7057f,95.2381f, 29.2295f,100, 48.2771f,100, 57.801f,95.2381f, 62.5629f,90.4762f,
+	67.3248f,80.9524f, 67.3248f,71.4286f, 62.5629f,61.9048f, 53.039f,47.619f, 5.42f,0, 72.0867f,0,
+	// 51 3
+	14.5238f,100, 66.9048f,100, 38.3333f,61.9048f, 52.619f,61.9048f, 62.1429f,57.1429f, 66.9048f,52.381f, 71.6667f,38.0952f, 71.6667f,28.5714f,
+	66.9048f,14.2857f, 57.381f,4.7619f, 43.0952f,0, 28.8095f,0, 14.5238f,4.7619f, 9.7619f,9.5238f, 5,19.0476f,
+	// 52 4
+	51.499f,100, 3.88f,33.3333f, 75.3086f,33.3333f,
+	51.499f,100, 51.499f,0,
+	// 53 5
+	62.0029f,100, 14.3838f,100, 9.6219f,57.1429f, 14.3838f,61.9048f, 28.6695f,66.6667f, 42.9552f,66.6667f, 57.241f,61.9048f, 66.7648f,52.381f,
+	71.5267f,38.0952f, 71.5267f,28.5714f, 66.7648f,14.2857f, 57.241f,4.7619f, 42.9552f,0, 28.6695f,0, 14.3838f,4.7619f, 9.6219f,9.5238f,
+	4.86f,19.0476f,
+	// 54 6
+	62.7229f,85.7143f, 57.961f,95.2381f, 43.6752f,100, 34.1514f,100, 19.8657f,95.2381f, 10.3419f,80.9524f, 5.58f,57.1429f, 5.58f,33.3333f,
+	10.3419f,14.2857f, 19.8657f,4.7619f, 34.1514f,0, 38.9133f,0, 53.199f,4.7619f, 62.7229f,14.2857f, 67.4848f,28.5714f, 67.4848f,33.3333f,
+	62.7229f,47.619f, 53.199f,57.1429f, 38.9133f,61.9048f, 34.1514f,61.9048f, 19.8657f,57.1429f, 10.3419f,47.619f, 5.58f,33.3333f,
+	// 55 7
+	72.2267f,100, 24.6076f,0,
+	5.56f,100, 72.2267f,100,
+	// 56 8
+	29.4095f,100, 15.1238f,95.2381f, 10.3619f,85.7143f, 10.3619f,76.1905f, 15.1238f,66.6667f, 24.6476f,61.9048f, 43.6952f,57.1429f, 57.981f,52.381f,
+	67.5048f,42.8571f, 72.2667f,33.3333f, 72.2667f,19.0476f, 67.5048f,9.5238f, 62.7429f,4.7619f, 48.4571f,0, 29.4095f,0, 15.1238f,4.7619f,
+	10.3619f,9.5238f, 5.6f,19.0476f, 5.6f,33.3333f, 10.3619f,42.8571f, 19.8857f,52.381f, 34.1714f,57.1429f, 53.219f,61.9048f, 62.7429f,66.6667f,
+	67.5048f,76.1905f, 67.5048f,85.7143f, 62.7429f,95.2381f, 48.4571f,100, 29.4095f,100,
+	// 57 9
+	68.5048f,66.6667f, 63.7429f,52.381f, 54.219f,42.8571f, 39.9333f,38.0952f, 35.1714f,38.0952f, 20.8857f,42.8571f, 11.3619f,52.381f, 6.6f,66.6667f,
+	6.6f,71.4286f, 11.3619f,85.7143f, 20.8857f,95.2381f, 35.1714f,100, 39.9333f,100, 54.219f,95.2381f, 63.7429f,85.7143f, 68.5048f,66.6667f,
+	68.5048f,42.8571f, 63.7429f,19.0476f, 54.219f,4.7619f, 39.9333f,0, 30.4095f,0, 16.1238f,4.7619f, 11.3619f,14.2857f,
+	// 58 :
+	14.0819f,66.6667f, 9.32f,61.9048f, 14.0819f,57.1429f, 18.8438f,61.9048f, 14.0819f,66.6667f,
+	14.0819f,9.5238f, 9.32f,4.7619f, 14.0819f,0, 18.8438f,4.7619f, 14.0819f,9.5238f,
+	// 59 ;
+	12.9619f,66.6667f, 8.2f,61.9048f, 12.9619f,57.1429f, 17.7238f,61.9048f, 12.9619f,66.6667f,
+	17.7238f,4.7619f, 12.9619f,0, 8.2f,4.7619f, 12.9619f,9.5238f, 17.7238f,4.7619f, 17.7238f,-4.7619f, 12.9619f,-14.2857f, 8.2f,-19.0476f,
+	// 60 <
+	79.2505f,85.7143f, 3.06f,42.8571f, 79.2505f,0,
+	// 61 =
+	5.7f,57.1429f, 91.4143f,57.1429f,
+	5.7f,28.5714f, 91.4143f,28.5714f,
+	// 62 >
+	2.78f,85.7143f, 78.9705f,42.8571f, 2.78f,0,
+	// 63 ?
+	8.42f,76.1905f, 8.42f,80.9524f, 13.1819f,90.4762f, 17.9438f,95.2381f, 27.4676f,100, 46.5152f,100, 56.039f,95.2381f, 60.801f,90.4762f,
+	65.5629f,80.9524f, 65.5629f,71.4286f, 60.801f,61.9048f, 56.039f,57.1429f, 36.9914f,47.619f, 36.9914f,33.3333f,
+	36.9914f,9.5238f, 32.2295f,4.7619f, 36.9914f,0, 41.7533f,4.7619f, 36.9914f,9.5238f,
+	// 64 @
+	49.2171f,52.381f, 39.6933f,57.1429f, 30.1695f,57.1429f, 25.4076f,47.619f, 25.4076f,42.8571f, 30.1695f,33.3333f, 39.6933f,33.3333f, 49.2171f,38.0952f,
+	49.2171f,57.1429f, 49.2171f,38.0952f, 53.979f,33.3333f, 63.5029f,33.3333f, 68.2648f,42.8571f, 68.2648f,47.619f, 63.5029f,61.9048f, 53.979f,71.4286f,
+	39.6933f,76.1905f, 34.9314f,76.1905f, 20.6457f,71.4286f, 11.1219f,61.9048f, 6.36f,47.619f, 6.36f,42.8571f, 11.1219f,28.5714f, 20.6457f,19.0476f,
+	34.9314f,14.2857f, 39.6933f,14.2857f, 53.979f,19.0476f,
+	// 65 A
+	40.5952f,100, 2.5f,0,
+	40.5952f,100, 78.6905f,0,
+	16.7857f,33.3333f, 64.4048f,33.3333f,
+	// 66 B
+	11.42f,100, 11.42f,0,
+	11.42f,100, 54.2771f,100, 68.5629f,95.2381f, 73.3248f,90.4762f, 78.0867f,80.9524f, 78.0867f,71.4286f, 73.3248f,61.9048f, 68.5629f,57.1429f,
+	54.2771f,52.381f,
+	11.42f,52.381f, 54.2771f,52.381f, 68.5629f,47.619f, 73.3248f,42.8571f, 78.0867f,33.3333f, 78.0867f,19.0476f, 73.3248f,9.5238f, 68.5629f,4.7619f,
+	54.2771f,0, 11.42f,0,
+	// 67 C
+	78.0886f,76.1905f, 73.3267f,85.7143f, 63.8029f,95.2381f, 54.279f,100, 35.2314f,100, 25.7076f,95.2381f, 16.1838f,85.7143f, 11.4219f,76.1905f,
+	6.66f,61.9048f, 6.66f,38.0952f, 11.4219f,23.8095f, 16.1838f,14.2857f, 25.7076f,4.7619f, 35.2314f,0, 54.279f,0, 63.8029f,4.7619f,
+	73.3267f,14.2857f, 78.0886f,23.8095f,
+	// 68 D
+	11.96f,100, 11.96f,0,
+	11.96f,100, 45.2933f,100, 59.579f,95.2381f, 69.1029f,85.7143f, 73.8648f,76.1905f, 78.6267f,61.9048f, 78.6267f,38.0952f, 73.8648f,23.8095f,
+	69.1029f,14.2857f, 59.579f,4.7619f, 45.2933f,0, 11.96f,0,
+	// 69 E
+	11.42f,100, 11.42f,0,
+	11.42f,100, 73.3248f,100,
+	11.42f,52.381f, 49.5152f,52.381f,
+	11.42f,0, 73.3248f,0,
+	// 70 F
+	11.42f,100, 11.42f,0,
+	11.42f,100, 73.3248f,100,
+	11.42f,52.381f, 49.5152f,52.381f,
+	// 71 G
+	78.4886f,76.1905f, 73.7267f,85.7143f, 64.2029f,95.2381f, 54.679f,100, 35.6314f,100, 26.1076f,95.2381f, 16.5838f,85.7143f, 11.8219f,76.1905f,
+	7.06f,61.9048f, 7.06f,38.0952f, 11.8219f,23.8095f, 16.5838f,14.2857f, 26.1076f,4.7619f, 35.6314f,0, 54.679f,0, 64.2029f,4.7619f,
+	73.7267f,14.2857f, 78.4886f,23.8095f, 78.4886f,38.0952f,
+	54.679f,38.0952f, 78.4886f,38.0952f,
+	// 72 H
+	11.42f,100, 11.42f,0,
+	78.0867f,100, 78.0867f,0,
+	11.42f,52.381f, 78.0867f,52.381f,
+	// 73 I
+	10.86f,100, 10.86f,0,
+	// 74 J
+	50.119f,100, 50.119f,23.8095f, 45.3571f,9.5238f, 40.5952f,4.7619f, 31.0714f,0, 21.5476f,0, 12.0238f,4.7619f, 7.2619f,9.5238f,
+	2.5f,23.8095f, 2.5f,33.3333f,
+	// 75 K
+	11.28f,100, 11.28f,0,
+	77.9467f,100, 11.28f,33.3333f,
+	35.0895f,57.1429f, 77.9467f,0,
+	// 76 L
+	11.68f,100, 11.68f,0,
+	11.68f,0, 68.8229f,0,
+	// 77 M
+	10.86f,100, 10.86f,0,
+	10.86f,100, 48.9552f,0,
+	87.0505f,100, 48.9552f,0,
+	87.0505f,100, 87.0505f,0,
+	// 78 N
+	11.14f,100, 11.14f,0,
+	11.14f,100, 77.8067f,0,
+	77.8067f,100, 77.8067f,0,
+	// 79 O
+	34.8114f,100, 25.2876f,95.2381f, 15.7638f,85.7143f, 11.0019f,76.1905f, 6.24f,61.9048f, 6.24f,38.0952f, 11.0019f,23.8095f, 15.7638f,14.2857f,
+	25.2876f,4.7619f, 34.8114f,0, 53.859f,0, 63.3829f,4.7619f, 72.9067f,14.2857f, 77.6686f,23.8095f, 82.4305f,38.0952f, 82.4305f,61.9048f,
+	77.6686f,76.1905f, 72.9067f,85.7143f, 63.3829f,95.2381f, 53.859f,100, 34.8114f,100,
+	// 80 P
+	12.1f,100, 12.1f,0,
+	12.1f,100, 54.9571f,100, 69.2429f,95.2381f, 74.0048f,90.4762f, 78.7667f,80.9524f, 78.7667f,66.6667f, 74.0048f,57.1429f, 69.2429f,52.381f,
+	54.9571f,47.619f, 12.1f,47.619f,
+	// 81 Q
+	33.8714f,100, 24.3476f,95.2381f, 14.8238f,85.7143f, 10.0619f,76.1905f, 5.3f,61.9048f, 5.3f,38.0952f, 10.0619f,23.8095f, 14.8238f,14.2857f,
+	24.3476f,4.7619f, 33.8714f,0, 52.919f,0, 62.4429f,4.7619f, 71.9667f,14.2857f, 76.7286f,23.8095f, 81.4905f,38.0952f, 81.4905f,61.9048f,
+	76.7286f,76.1905f, 71.9667f,85.7143f, 62.4429f,95.2381f, 52.919f,100, 33.8714f,100,
+	48.1571f,19.0476f, 76.7286f,-9.5238f,
+	// 82 R
+	11.68f,100, 11.68f,0,
+	11.68f,100, 54.5371f,100, 68.8229f,95.2381f, 73.5848f,90.4762f, 78.3467f,80.9524f, 78.3467f,71.4286f, 73.5848f,61.9048f, 68.8229f,57.1429f,
+	54.5371f,52.381f, 11.68f,52.381f,
+	45.0133f,52.381f, 78.3467f,0,
+	// 83 S
+	74.6667f,85.7143f, 65.1429f,95.2381f, 50.8571f,100, 31.8095f,100, 17.5238f,95.2381f, 8,85.7143f, 8,76.1905f, 12.7619f,66.6667f,
+	17.5238f,61.9048f, 27.0476f,57.1429f, 55.619f,47.619f, 65.1429f,42.8571f, 69.9048f,38.0952f, 74.6667f,28.5714f, 74.6667f,14.2857f, 65.1429f,4.7619f,
+	50.8571f,0, 31.8095f,0, 17.5238f,4.7619f, 8,14.2857f,
+	// 84 T
+	35.6933f,100, 35.6933f,0,
+	2.36f,100, 69.0267f,100,
+	// 85 U
+	11.54f,100, 11.54f,28.5714f, 16.3019f,14.2857f, 25.8257f,4.7619f, 40.1114f,0, 49.6352f,0, 63.921f,4.7619f, 73.4448f,14.2857f,
+	78.2067f,28.5714f, 78.2067f,100,
+	// 86 V
+	2.36f,100, 40.4552f,0,
+	78.5505f,100, 40.4552f,0,
+	// 87 W
+	2.22f,100, 26.0295f,0,
+	49.839f,100, 26.0295f,0,
+	49.839f,100, 73.6486f,0,
+	97.4581f,100, 73.6486f,0,
+	// 88 X
+	2.5f,100, 69.1667f,0,
+	69.1667f,100, 2.5f,0,
+	// 89 Y
+	1.52f,100, 39.6152f,52.381f, 39.6152f,0,
+	77.7105f,100, 39.6152f,52.381f,
+	// 90 Z
+	69.1667f,100, 2.5f,0,
+	2.5f,100, 69.1667f,100,
+	2.5f,0, 69.1667f,0,
+	// 91 [
+	7.78f,119.048f, 7.78f,-33.3333f,
+	12.5419f,119.048f, 12.5419f,-33.3333f,
+	7.78f,119.048f, 41.1133f,119.048f,
+	7.78f,-33.3333f, 41.1133f,-33.3333f,
+	// 92
+	5.84f,100, 72.5067f,-14.2857f,
+	// 93 ]
+	33.0114f,119.048f, 33.0114f,-33.3333f,
+	37.7733f,119.048f, 37.7733f,-33.3333f,
+	4.44f,119.048f, 37.7733f,119.048f,
+	4.44f,-33.3333f, 37.7733f,-33.3333f,
+	// 94 ^
+	44.0752f,109.524f, 5.98f,42.8571f,
+	44.0752f,109.524f, 82.1705f,42.8571f,
+	// 95 _
+	-1.1f,-33.3333f, 103.662f,-33.3333f, 103.662f,-28.5714f, -1.1f,-28.5714f, -1.1f,-33.3333f,
+	// 96 `
+	33.0219f,100, 56.8314f,71.4286f,
+	33.0219f,100, 28.26f,95.2381f, 56.8314f,71.4286f,
+	// 97 a
+	63.8229f,66.6667f, 63.8229f,0,
+	63.8229f,52.381f, 54.299f,61.9048f, 44.7752f,66.6667f, 30.4895f,66.6667f, 20.9657f,61.9048f, 11.4419f,52.381f, 6.68f,38.0952f, 6.68f,28.5714f,
+	11.4419f,14.2857f, 20.9657f,4.7619f, 30.4895f,0, 44.7752f,0, 54.299f,4.7619f, 63.8229f,14.2857f,
+	// 98 b
+	8.76f,100, 8.76f,0,
+	8.76f,52.381f, 18.2838f,61.9048f, 27.8076f,66.6667f, 42.0933f,66.6667f, 51.6171f,61.9048f, 61.141f,52.381f, 65.9029f,38.0952f, 65.9029f,28.5714f,
+	61.141f,14.2857f, 51.6171f,4.7619f, 42.0933f,0, 27.8076f,0, 18.2838f,4.7619f, 8.76f,14.2857f,
+	// 99 c
+	62.6629f,52.381f, 53.139f,61.9048f, 43.6152f,66.6667f, 29.3295f,66.6667f, 19.8057f,61.9048f, 10.2819f,52.381f, 5.52f,38.0952f, 5.52f,28.5714f,
+	10.2819f,14.2857f, 19.8057f,4.7619f, 29.3295f,0, 43.6152f,0, 53.139f,4.7619f, 62.6629f,14.2857f,
+	// 100 d
+	61.7829f,100, 61.7829f,0,
+	61.7829f,52.381f, 52.259f,61.9048f, 42.7352f,66.6667f, 28.4495f,66.6667f, 18.9257f,61.9048f, 9.4019f,52.381f, 4.64f,38.0952f, 4.64f,28.5714f,
+	9.4019f,14.2857f, 18.9257f,4.7619f, 28.4495f,0, 42.7352f,0, 52.259f,4.7619f, 61.7829f,14.2857f,
+	// 101 e
+	5.72f,38.0952f, 62.8629f,38.0952f, 62.8629f,47.619f, 58.101f,57.1429f, 53.339f,61.9048f, 43.8152f,66.6667f, 29.5295f,66.6667f, 20.0057f,61.9048f,
+	10.4819f,52.381f, 5.72f,38.0952f, 5.72f,28.5714f, 10.4819f,14.2857f, 20.0057f,4.7619f, 29.5295f,0, 43.8152f,0, 53.339f,4.7619f,
+	62.8629f,14.2857f,
+	// 102 f
+	38.7752f,100, 29.2514f,100, 19.7276f,95.2381f, 14.9657f,80.9524f, 14.9657f,0,
+	0.68f,66.6667f, 34.0133f,66.6667f,
+	// 103 g
+	62.5029f,66.6667f, 62.5029f,-9.5238f, 57.741f,-23.8095f, 52.979f,-28.5714f, 43.4552f,-33.3333f, 29.1695f,-33.3333f, 19.6457f,-28.5714f,
+	62.5029f,52.381f, 52.979f,61.9048f, 43.4552f,66.6667f, 29.1695f,66.6667f, 19.6457f,61.9048f, 10.1219f,52.381f, 5.36f,38.0952f, 5.36f,28.5714f,
+	10.1219f,14.2857f, 19.6457f,4.7619f, 29.1695f,0, 43.4552f,0, 52.979f,4.7619f, 62.5029f,14.2857f,
+	// 104 h
+	9.6f,100, 9.6f,0,
+	9.6f,47.619f, 23.8857f,61.9048f, 33.4095f,66.6667f, 47.6952f,66.6667f, 57.219f,61.9048f, 61.981f,47.619f, 61.981f,0,
+	// 105 i
+	10.02f,100, 14.7819f,95.2381f, 19.5438f,100, 14.7819f,104.762f, 10.02f,100,
+	14.7819f,66.6667f, 14.7819f,0,
+	// 106 j
+	17.3876f,100, 22.1495f,95.2381f, 26.9114f,100, 22.1495f,104.762f, 17.3876f,100,
+	22.1495f,66.6667f, 22.1495f,-14.2857f, 17.3876f,-28.5714f, 7.8638f,-33.3333f, -1.66f,-33.3333f,
+	// 107 k
+	9.6f,100, 9.6f,0,
+	57.219f,66.6667f, 9.6f,19.0476f,
+	28.6476f,38.0952f, 61.981f,0,
+	// 108 l
+	10.02f,100, 10.02f,0,
+	// 109 m
+	9.6f,66.6667f, 9.6f,0,
+	9.6f,47.619f, 23.8857f,61.9048f, 33.4095f,66.6667f, 47.6952f,66.6667f, 57.219f,61.9048f, 61.981f,47.619f, 61.981f,0,
+	61.981f,47.619f, 76.2667f,61.9048f, 85.7905f,66.6667f, 100.076f,66.6667f, 109.6f,61.9048f, 114.362f,47.619f, 114.362f,0,
+	// 110 n
+	9.18f,66.6667f, 9.18f,0,
+	9.18f,47.619f, 23.4657f,61.9048f, 32.9895f,66.6667f, 47.2752f,66.6667f, 56.799f,61.9048f, 61.561f,47.619f, 61.561f,0,
+	// 111 o
+	28.7895f,66.6667f, 19.2657f,61.9048f, 9.7419f,52.381f, 4.98f,38.0952f, 4.98f,28.5714f, 9.7419f,14.2857f, 19.2657f,4.7619f, 28.7895f,0,
+	43.0752f,0, 52.599f,4.7619f, 62.1229f,14.2857f, 66.8848f,28.5714f, 66.8848f,38.0952f, 62.1229f,52.381f, 52.599f,61.9048f, 43.0752f,66.6667f,
+	28.7895f,66.6667f,
+	// 112 p
+	9.46f,66.6667f, 9.46f,-33.3333f,
+	9.46f,52.381f, 18.9838f,61.9048f, 28.5076f,66.6667f, 42.7933f,66.6667f, 52.3171f,61.9048f, 61.841f,52.381f, 66.6029f,38.0952f, 66.6029f,28.5714f,
+	61.841f,14.2857f, 52.3171f,4.7619f, 42.7933f,0, 28.5076f,0, 18.9838f,4.7619f, 9.46f,14.2857f,
+	// 113 q
+	61.9829f,66.6667f, 61.9829f,-33.3333f,
+	61.9829f,52.381f, 52.459f,61.9048f, 42.9352f,66.6667f, 28.6495f,66.6667f, 19.1257f,61.9048f, 9.6019f,52.381f, 4.84f,38.0952f, 4.84f,28.5714f,
+	9.6019f,14.2857f, 19.1257f,4.7619f, 28.6495f,0, 42.9352f,0, 52.459f,4.7619f, 61.9829f,14.2857f,
+	// 114 r
+	9.46f,66.6667f, 9.46f,0,
+	9.46f,38.0952f, 14.2219f,52.381f, 23.7457f,61.9048f, 33.2695f,66.6667f, 47.5552f,66.6667f,
+	// 115 s
+	57.081f,52.381f, 52.319f,61.9048f, 38.0333f,66.6667f, 23.7476f,66.6667f, 9.4619f,61.9048f, 4.7f,52.381f, 9.4619f,42.8571f, 18.9857f,38.0952f,
+	42.7952f,33.3333f, 52.319f,28.5714f, 57.081f,19.0476f, 57.081f,14.2857f, 52.319f,4.7619f, 38.0333f,0, 23.7476f,0, 9.4619f,4.7619f,
+	4.7f,14.2857f,
+	// 116 t
+	14.8257f,100, 14.8257f,19.0476f, 19.5876f,4.7619f, 29.1114f,0, 38.6352f,0,
+	0.54f,66.6667f, 33.8733f,66.6667f,
+	// 117 u
+	9.46f,66.6667f, 9.46f,19.0476f, 14.2219f,4.7619f, 23.7457f,0, 38.0314f,0, 47.5552f,4.7619f, 61.841f,19.0476f,
+	61.841f,66.6667f, 61.841f,0,
+	// 118 v
+	1.8f,66.6667f, 30.3714f,0,
+	58.9429f,66.6667f, 30.3714f,0,
+	// 119 w
+	2.5f,66.6667f, 21.5476f,0,
+	40.5952f,66.6667f, 21.5476f,0,
+	40.5952f,66.6667f, 59.6429f,0,
+	78.6905f,66.6667f, 59.6429f,0,
+	// 120 x
+	1.66f,66.6667f, 54.041f,0,
+	54.041f,66.6667f, 1.66f,0,
+	// 121 y
+	6.5619f,66.6667f, 35.1333f,0,
+	63.7048f,66.6667f, 35.1333f,0, 25.6095f,-19.0476f, 16.0857f,-28.5714f, 6.5619f,-33.3333f, 1.8f,-33.3333f,
+	// 122 z
+	56.821f,66.6667f, 4.44f,0,
+	4.44f,66.6667f, 56.821f,66.6667f,
+	4.44f,0, 56.821f,0,
+	// 123 {
+	31.1895f,119.048f, 21.6657f,114.286f, 16.9038f,109.524f, 12.1419f,100, 12.1419f,90.4762f, 16.9038f,80.9524f, 21.6657f,76.1905f, 26.4276f,66.6667f,
+	26.4276f,57.1429f, 16.9038f,47.619f,
+	21.6657f,114.286f, 16.9038f,104.762f, 16.9038f,95.2381f, 21.6657f,85.7143f, 26.4276f,80.9524f, 31.1895f,71.4286f, 31.1895f,61.9048f, 26.4276f,52.381f,
+	7.38f,42.8571f, 26.4276f,33.3333f, 31.1895f,23.8095f, 31.1895f,14.2857f, 26.4276f,4.7619f, 21.6657f,0, 16.9038f,-9.5238f, 16.9038f,-19.0476f,
+	21.6657f,-28.5714f,
+	16.9038f,38.0952f, 26.4276f,28.5714f, 26.4276f,19.0476f, 21.6657f,9.5238f, 16.9038f,4.7619f, 12.1419f,-4.7619f, 12.1419f,-14.2857f, 16.9038f,-23.8095f,
+	21.6657f,-28.5714f, 31.1895f,-33.3333f,
+	// 124 |
+	11.54f,119.048f, 11.54f,-33.3333f,
+	// 125 }
+	9.18f,119.048f, 18.7038f,114.286f, 23.4657f,109.524f, 28.2276f,100, 28.2276f,90.4762f, 23.4657f,80.9524f, 18.7038f,76.1905f, 13.9419f,66.6667f,
+	13.9419f,57.1429f, 23.4657f,47.619f,
+	18.7038f,114.286f, 23.4657f,104.762f, 23.4657f,95.2381f, 18.7038f,85.7143f, 13.9419f,80.9524f, 9.18f,71.4286f, 9.18f,61.9048f, 13.9419f,52.381f,
+	32.9895f,42.8571f, 13.9419f,33.3333f, 9.18f,23.8095f, 9.18f,14.2857f, 13.9419f,4.7619f, 18.7038f,0, 23.4657f,-9.5238f, 23.4657f,-19.0476f,
+	18.7038f,-28.5714f,
+	23.4657f,38.0952f, 13.9419f,28.5714f, 13.9419f,19.0476f, 18.7038f,9.5238f, 23.4657f,4.7619f, 28.2276f,-4.7619f, 28.2276f,-14.2857f, 23.4657f,-23.8095f,
+	18.7038f,-28.5714f, 9.18f,-33.3333f,
+	// 126 ~
+	2.92f,28.5714f, 2.92f,38.0952f, 7.6819f,52.381f, 17.2057f,57.1429f, 26.7295f,57.1429f, 36.2533f,52.381f, 55.301f,38.0952f, 64.8248f,33.3333f,
+	74.3486f,33.3333f, 83.8724f,38.0952f, 88.6343f,47.619f,
+	2.92f,38.0952f, 7.6819f,47.619f, 17.2057f,52.381f, 26.7295f,52.381f, 36.2533f,47.619f, 55.301f,33.3333f, 64.8248f,28.5714f, 74.3486f,28.5714f,
+	83.8724f,33.3333f, 88.6343f,47.619f, 88.6343f,57.1429f,
+	// 127
+	52.381f,100, 14.2857f,-33.3333f,
+	28.5714f,66.6667f, 14.2857f,61.9048f, 4.7619f,52.381f, 0,38.0952f, 0,23.8095f, 4.7619f,14.2857f, 14.2857f,4.7619f, 28.5714f,0,
+	38.0952f,0, 52.381f,4.7619f, 61.9048f,14.2857f, 66.6667f,28.5714f, 66.6667f,42.8571f, 61.9048f,52.381f, 52.381f,61.9048f, 38.0952f,66.6667f,
+	28.5714f,66.6667f,
+};
+
+static const unsigned char RomanStrips[] =
+{
+	2, 5,   // 33
+	2, 2,   // 34
+	2, 2, 2, 2,   // 35
+	2, 2, 20,   // 36
+	2, 16, 11,   // 37
+	34,   // 38
+	2,   // 39
+	10,   // 40
+	10,   // 41
+	2, 2, 2,   // 42
+	2, 2,   // 43
+	8,   // 44
+	2,   // 45
+	5,   // 46
+	2,   // 47
+	17,   // 48
+	4,   // 49
+	14,   // 50
+	15,   // 51
+	3, 2,   // 52
+	17,   // 53
+	23,   // 54
+	2, 2,   // 55
+	29,   // 56
+	23,   // 57
+	5, 5,   // 58
+	5, 8,   // 59
+	3,   // 60
+	2, 2,   // 61
+	3,   // 62
+	14, 5,   // 63
+	8, 19,   // 64
+	2, 2, 2,   // 65
+	2, 9, 10,   // 66
+	18,   // 67
+	2, 12,   // 68
+	2, 2, 2, 2,   // 69
+	2, 2, 2,   // 70
+	19, 2,   // 71
+	2, 2, 2,   // 72
+	2,   // 73
+	10,   // 74
+	2, 2, 2,   // 75
+	2, 2,   // 76
+	2, 2, 2, 2,   // 77
+	2, 2, 2,   // 78
+	21,   // 79
+	2, 10,   // 80
+	21, 2,   // 81
+	2, 10, 2,   // 82
+	20,   // 83
+	2, 2,   // 84
+	10,   // 85
+	2, 2,   // 86
+	2, 2, 2, 2,   // 87
+	2, 2,   // 88
+	3, 2,   // 89
+	2, 2, 2,   // 90
+	2, 2, 2, 2,   // 91
+	2,   // 92
+	2, 2, 2, 2,   // 93
+	2, 2,   // 94
+	5,   // 95
+	2, 3,   // 96
+	2, 14,   // 97
+	2, 14,   // 98
+	14,   // 99
+	2, 14,   // 100
+	17,   // 101
+	5, 2,   // 102
+	7, 14,   // 103
+	2, 7,   // 104
+	5, 2,   // 105
+	5, 5,   // 106
+	2, 2, 2,   // 107
+	2,   // 108
+	2, 7, 7,   // 109
+	2, 7,   // 110
+	17,   // 111
+	2, 14,   // 112
+	2, 14,   // 113
+	2, 5,   // 114
+	17,   // 115
+	5, 2,   // 116
+	7, 2,   // 117
+	2, 2,   // 118
+	2, 2, 2, 2,   // 119
+	2, 2,   // 120
+	2, 6,   // 121
+	2, 2, 2,   // 122
+	10, 17, 10,   // 123
+	2,   // 124
+	10, 17, 10,   // 125
+	11, 11,   // 126
+	2, 17,   // 127
+};
+
+static const StrokeGlyph RomanGlyphs[96] =
+{
+	{ 104.762f, 0 }, { 26.6238f, 2 }, { 51.4352f, 2 }, { 79.4886f, 4 },
+	{ 76.2067f, 3 }, { 96.5743f, 3 }, { 101.758f, 1 }, { 13.62f, 1 },
+	{ 47.1733f, 1 }, { 47.5333f, 1 }, { 59.439f, 3 }, { 97.2543f, 2 },
+	{ 26.0638f, 1 }, { 100.754f, 1 }, { 26.4838f, 1 }, { 82.1067f, 1 },
+	{ 77.0667f, 1 }, { 66.5295f, 1 }, { 77.6467f, 1 }, { 77.0467f, 1 },
+	{ 80.1686f, 2 }, { 77.6867f, 1 }, { 73.8048f, 1 }, { 77.2267f, 2 },
+	{ 77.6667f, 1 }, { 74.0648f, 1 }, { 26.2238f, 2 }, { 26.3038f, 2 },
+	{ 81.6105f, 1 }, { 97.2543f, 2 }, { 81.6105f, 1 }, { 73.9029f, 2 },
+	{ 74.3648f, 2 }, { 80.4905f, 3 }, { 83.6267f, 3 }, { 84.4886f, 1 },
+	{ 85.2867f, 2 }, { 78.1848f, 4 }, { 78.7448f, 3 }, { 89.7686f, 2 },
+	{ 89.0867f, 3 }, { 21.3f, 1 }, { 59.999f, 1 }, { 79.3267f, 3 },
+	{ 71.3229f, 2 }, { 97.2105f, 4 }, { 88.8067f, 3 }, { 88.8305f, 1 },
+	{ 85.6667f, 2 }, { 88.0905f, 2 }, { 82.3667f, 3 }, { 80.8267f, 1 },
+	{ 71.9467f, 2 }, { 89.4867f, 1 }, { 81.6105f, 2 }, { 100.518f, 4 },
+	{ 72.3667f, 2 }, { 79.6505f, 2 }, { 73.7467f, 3 }, { 46.1133f, 4 },
+	{ 78.2067f, 1 }, { 46.3933f, 4 }, { 90.2305f, 2 }, { 104.062f, 1 },
+	{ 83.5714f, 2 }, { 66.6029f, 2 }, { 70.4629f, 2 }, { 68.9229f, 1 },
+	{ 70.2629f, 2 }, { 68.5229f, 1 }, { 38.6552f, 2 }, { 70.9829f, 2 },
+	{ 71.021f, 2 }, { 28.8638f, 2 }, { 36.2314f, 2 }, { 62.521f, 3 },
+	{ 19.34f, 1 }, { 123.962f, 3 }, { 70.881f, 2 }, { 71.7448f, 1 },
+	{ 70.8029f, 2 }, { 70.7429f, 2 }, { 49.4952f, 2 }, { 62.321f, 1 },
+	{ 39.3152f, 2 }, { 71.161f, 2 }, { 60.6029f, 2 }, { 80.4905f, 4 },
+	{ 56.401f, 2 }, { 66.0648f, 2 }, { 61.821f, 3 }, { 41.6295f, 3 },
+	{ 23.78f, 1 }, { 41.4695f, 3 }, { 91.2743f, 2 }, { 66.6667f, 2 },
+};
+
+static const float MonoRomanPoints[] =
+{
+	// 33 !
+	52.381f,100, 52.381f,33.3333f,
+	52.381f,9.5238f, 47.6191f,4.7619f, 52.381f,0, 57.1429f,4.7619f, 52.381f,9.5238f,
+	// 34 "
+	33.3334f,100, 33.3334f,66.6667f,
+	71.4286f,100, 71.4286f,66.6667f,
+	// 35 #
+	54.7619f,119.048f, 21.4286f,-33.3333f,
+	83.3334f,119.048f, 50,-33.3333f,
+	21.4286f,57.1429f, 88.0952f,57.1429f,
+	16.6667f,28.5714f, 83.3334f,28.5714f,
+	// 36 $
+	42.8571f,119.048f, 42.8571f,-19.0476f,
+	61.9047f,119.048f, 61.9047f,-19.0476f,
+	85.7143f,85.7143f, 76.1905f,95.2381f, 61.9047f,100, 42.8571f,100, 28.5714f,95.2381f, 19.0476f,85.7143f, 19.0476f,76.1905f, 23.8095f,66.6667f,
+	28.5714f,61.9048f, 38.0952f,57.1429f, 66.6666f,47.619f, 76.1905f,42.8571f, 80.9524f,38.0952f, 85.7143f,28.5714f, 85.7143f,14.2857f, 76.1905f,4.7619f,
+	61.9047f,0, 42.8571f,0, 28.5714f,4.7619f, 19.0476f,14.2857f,
+	// 37 %
+	95.2381f,100, 9.5238f,0,
+	33.3333f,100, 42.8571f,90.4762f, 42.8571f,80.9524f, 38.0952f,71.4286f, 28.5714f,66.6667f, 19.0476f,66.6667f, 9.5238f,76.1905f, 9.5238f,85.7143f,
+	14.2857f,95.2381f, 23.8095f,100, 33.3333f,100, 42.8571f,95.2381f, 57.1428f,90.4762f, 71.4286f,90.4762f, 85.7143f,95.2381f, 95.2381f,100,
+	76.1905f,33.3333f, 66.6667f,28.5714f, 61.9048f,19.0476f, 61.9048f,9.5238f, 71.4286f,0, 80.9524f,0, 90.4762f,4.7619f, 95.2381f,14.2857f,
+	95.2381f,23.8095f, 85.7143f,33.3333f, 76.1905f,33.3333f,
+	// 38 &
+	100,57.1429f, 100,61.9048f, 95.2381f,66.6667f, 90.4762f,66.6667f, 85.7143f,61.9048f, 80.9524f,52.381f, 71.4286f,28.5714f, 61.9048f,14.2857f,
+	52.3809f,4.7619f, 42.8571f,0, 23.8095f,0, 14.2857f,4.7619f, 9.5238f,9.5238f, 4.7619f,19.0476f, 4.7619f,28.5714f, 9.5238f,38.0952f,
+	14.2857f,42.8571f, 47.619f,61.9048f, 52.3809f,66.6667f, 57.1429f,76.1905f, 57.1429f,85.7143f, 52.3809f,95.2381f, 42.8571f,100, 33.3333f,95.2381f,
+	28.5714f,85.7143f, 28.5714f,76.1905f, 33.3333f,61.9048f, 42.8571f,47.619f, 66.6667f,14.2857f, 76.1905f,4.7619f, 85.7143f,0, 95.2381f,0,
+	100,4.7619f, 100,9.5238f,
+	// 39 '
+	52.381f,100, 52.381f,66.6667f,
+	// 40 (
+	69.0476f,119.048f, 59.5238f,109.524f, 50,95.2381f, 40.4762f,76.1905f, 35.7143f,52.381f, 35.7143f,33.3333f, 40.4762f,9.5238f, 50,-9.5238f,
+	59.5238f,-23.8095f, 69.0476f,-33.3333f,
+	// 41 )
+	35.7143f,119.048f, 45.2381f,109.524f, 54.7619f,95.2381f, 64.2857f,76.1905f, 69.0476f,52.381f, 69.0476f,33.3333f, 64.2857f,9.5238f, 54.7619f,-9.5238f,
+	45.2381f,-23.8095f, 35.7143f,-33.3333f,
+	// 42 *
+	52.381f,71.4286f, 52.381f,14.2857f,
+	28.5715f,57.1429f, 76.1905f,28.5714f,
+	76.1905f,57.1429f, 28.5715f,28.5714f,
+	// 43 +
+	52.3809f,85.7143f, 52.3809f,0,
+	9.5238f,42.8571f, 95.2381f,42.8571f,
+	// 44 ,
+	57.1429f,4.7619f, 52.381f,0, 47.6191f,4.7619f, 52.381f,9.5238f, 57.1429f,4.7619f, 57.1429f,-4.7619f, 52.381f,-14.2857f, 47.6191f,-19.0476f,
+	// 45 -
+	9.5238f,42.8571f, 95.2381f,42.8571f,
+	// 46 .
+	52.381f,9.5238f, 47.6191f,4.7619f, 52.381f,0, 57.1429f,4.7619f, 52.381f,9.5238f,
+	// 47 /
+	19.0476f,-14.2857f, 85.7143f,100,
+	// 48 0
+	47.619f,100, 33.3333f,95.2381f, 23.8095f,80.9524f, 19.0476f,57.1429f, 19.0476f,42.8571f, 23.8095f,19.0476f, 33.3333f,4.7619f, 47.619f,0,
+	57.1428f,0, 71.4286f,4.7619f, 80.9524f,19.0476f, 85.7143f,42.8571f, 85.7143f,57.1429f, 80.9524f,80.9524f, 71.4286f,95.2381f, 57.1428f,100,
+	47.619f,100,
+	// 49 1
+	40.4762f,80.9524f, 50,85.7143f, 64.2857f,100, 64.2857f,0,
+	// 50 2
+	23.8095f,76.1905f, 23.8095f,80.9524f, 28.5714f,90.4762f, 33.3333f,95.2381f, 42.8571f,100, 61.9047f,100, 71.4286f,95.2381f, 76.1905f,90.4762f,
+	80.9524f,80.9524f, 80.9524f,71.4286f, 76.1905f,61.9048f, 66.6666f,47.619f, 19.0476f,0, 85.7143f,0,
+	// 51 3
+	28.5714f,100, 80.9524f,100, 52.3809f,61.9048f, 66.6666f,61.9048f, 76.1905f,57.1429f, 80.9524f,52.381f, 85.7143f,38.0952f, 85.7143f,28.5714f,
+	80.9524f,14.2857f, 71.4286f,4.7619f, 57.1428f,0, 42.8571f,0, 28.5714f,4.7619f, 23.8095f,9.5238f, 19.0476f,19.0476f,
+	// 52 4
+	64.2857f,100, 16.6667f,33.3333f, 88.0952f,33.3333f,
+	64.2857f,100, 64.2857f,0,
+	// 53 5
+	76.1905f,100, 28.5714f,100, 23.8095f,57.1429f, 28.5714f,61.9048f, 42.8571f,66.6667f, 57.1428f,66.6667f, 71.4286f,61.9048f, 80.9524f,52.381f,
+	85.7143f,38.0952f, 85.7143f,28.5714f, 80.9524f,14.2857f, 71.4286f,4.7619f, 57.1428f,0, 42.8571f,0, 28.5714f,4.7619f, 23.8095f,9.5238f,
+	19.0476f,19.0476f,
+	// 54 6
+	78.5714f,85.7143f, 73.8096f,95.2381f, 59.5238f,100, 50,100, 35.7143f,95.2381f, 26.1905f,80.9524f, 21.4286f,57.1429f, 21.4286f,33.3333f,
+	26.1905f,14.2857f, 35.7143f,4.7619f, 50,0, 54.7619f,0, 69.0476f,4.7619f, 78.5714f,14.2857f, 83.3334f,28.5714f, 83.3334f,33.3333f,
+	78.5714f,47.619f, 69.0476f,57.1429f, 54.7619f,61.9048f, 50,61.9048f, 35.7143f,57.1429f, 26.1905f,47.619f, 21.4286f,33.3333f,
+	// 55 7
+	85.7143f,100, 38.0952f,0,
+	19.0476f,100, 85.7143f,100,
+	// 56 8
+	42.8571f,100, 28.5714f,95.2381f, 23.8095f,85.7143f, 23.8095f,76.1905f, 28.5714f,66.6667f, 38.0952f,61.9048f, 57.1428f,57.1429f, 71.4286f,52.381f,
+	80.9524f,42.8571f, 85.7143f,33.3333f, 85.7143f,19.0476f, 80.9524f,9.5238f, 76.1905f,4.7619f, 61.9047f,0, 42.8571f,0, 28.5714f,4.7619f,
+	23.8095f,9.5238f, 19.0476f,19.0476f, 19.0476f,33.3333f, 23.8095f,42.8571f, 33.3333f,52.381f, 47.619f,57.1429f, 66.6666f,61.9048f, 76.1905f,66.6667f,
+	80.9524f,76.1905f, 80.9524f,85.7143f, 76.1905f,95.2381f, 61.9047f,100, 42.8571f,100,
+	// 57 9
+	83.3334f,66.6667f, 78.5714f,52.381f, 69.0476f,42.8571f, 54.7619f,38.0952f, 50,38.0952f, 35.7143f,42.8571f, 26.1905f,52.381f, 21.4286f,66.6667f,
+	21.4286f,71.4286f, 26.1905f,85.7143f, 35.7143f,95.2381f, 50,100, 54.7619f,100, 69.0476f,95.2381f, 78.5714f,85.7143f, 83.3334f,66.6667f,
+	83.3334f,42.8571f, 78.5714f,19.0476f, 69.0476f,4.7619f, 54.7619f,0, 45.2381f,0, 30.9524f,4.7619f, 26.1905f,14.2857f,
+	// 58 :
+	52.381f,66.6667f, 47.6191f,61.9048f, 52.381f,57.1429f, 57.1429f,61.9048f, 52.381f,66.6667f,
+	52.381f,9.5238f, 47.6191f,4.7619f, 52.381f,0, 57.1429f,4.7619f, 52.381f,9.5238f,
+	// 59 ;
+	52.381f,66.6667f, 47.6191f,61.9048f, 52.381f,57.1429f, 57.1429f,61.9048f, 52.381f,66.6667f,
+	57.1429f,4.7619f, 52.381f,0, 47.6191f,4.7619f, 52.381f,9.5238f, 57.1429f,4.7619f, 57.1429f,-4.7619f, 52.381f,-14.2857f, 47.6191f,-19.0476f,
+	// 60 <
+	90.4762f,85.7143f, 14.2857f,42.8571f, 90.4762f,0,
+	// 61 =
+	9.5238f,57.1429f, 95.2381f,57.1429f,
+	9.5238f,28.5714f, 95.2381f,28.5714f,
+	// 62 >
+	14.2857f,85.7143f, 90.4762f,42.8571f, 14.2857f,0,
+	// 63 ?
+	23.8095f,76.1905f, 23.8095f,80.9524f, 28.5714f,90.4762f, 33.3333f,95.2381f, 42.8571f,100, 61.9047f,100, 71.4285f,95.2381f, 76.1905f,90.4762f,
+	80.9524f,80.9524f, 80.9524f,71.4286f, 76.1905f,61.9048f, 71.4285f,57.1429f, 52.3809f,47.619f, 52.3809f,33.3333f,
+	52.3809f,9.5238f, 47.619f,4.7619f, 52.3809f,0, 57.1428f,4.7619f, 52.3809f,9.5238f,
+	// 64 @
+	64.2857f,52.381f, 54.7619f,57.1429f, 45.2381f,57.1429f, 40.4762f,47.619f, 40.4762f,42.8571f, 45.2381f,33.3333f, 54.7619f,33.3333f, 64.2857f,38.0952f,
+	64.2857f,57.1429f, 64.2857f,38.0952f, 69.0476f,33.3333f, 78.5714f,33.3333f, 83.3334f,42.8571f, 83.3334f,47.619f, 78.5714f,61.9048f, 69.0476f,71.4286f,
+	54.7619f,76.1905f, 50,76.1905f, 35.7143f,71.4286f, 26.1905f,61.9048f, 21.4286f,47.619f, 21.4286f,42.8571f, 26.1905f,28.5714f, 35.7143f,19.0476f,
+	50,14.2857f, 54.7619f,14.2857f, 69.0476f,19.0476f,
+	// 65 A
+	52.3809f,100, 14.2857f,0,
+	52.3809f,100, 90.4762f,0,
+	28.5714f,33.3333f, 76.1905f,33.3333f,
+	// 66 B
+	19.0476f,100, 19.0476f,0,
+	19.0476f,100, 61.9047f,100, 76.1905f,95.2381f, 80.9524f,90.4762f, 85.7143f,80.9524f, 85.7143f,71.4286f, 80.9524f,61.9048f, 76.1905f,57.1429f,
+	61.9047f,52.381f,
+	19.0476f,52.381f, 61.9047f,52.381f, 76.1905f,47.619f, 80.9524f,42.8571f, 85.7143f,33.3333f, 85.7143f,19.0476f, 80.9524f,9.5238f, 76.1905f,4.7619f,
+	61.9047f,0, 19.0476f,0,
+	// 67 C
+	88.0952f,76.1905f, 83.3334f,85.7143f, 73.8096f,95.2381f, 64.2857f,100, 45.2381f,100, 35.7143f,95.2381f, 26.1905f,85.7143f, 21.4286f,76.1905f,
+	16.6667f,61.9048f, 16.6667f,38.0952f, 21.4286f,23.8095f, 26.1905f,14.2857f, 35.7143f,4.7619f, 45.2381f,0, 64.2857f,0, 73.8096f,4.7619f,
+	83.3334f,14.2857f, 88.0952f,23.8095f,
+	// 68 D
+	19.0476f,100, 19.0476f,0,
+	19.0476f,100, 52.3809f,100, 66.6666f,95.2381f, 76.1905f,85.7143f, 80.9524f,76.1905f, 85.7143f,61.9048f, 85.7143f,38.0952f, 80.9524f,23.8095f,
+	76.1905f,14.2857f, 66.6666f,4.7619f, 52.3809f,0, 19.0476f,0,
+	// 69 E
+	21.4286f,100, 21.4286f,0,
+	21.4286f,100, 83.3334f,100,
+	21.4286f,52.381f, 59.5238f,52.381f,
+	21.4286f,0, 83.3334f,0,
+	// 70 F
+	21.4286f,100, 21.4286f,0,
+	21.4286f,100, 83.3334f,100,
+	21.4286f,52.381f, 59.5238f,52.381f,
+	// 71 G
+	88.0952f,76.1905f, 83.3334f,85.7143f, 73.8096f,95.2381f, 64.2857f,100, 45.2381f,100, 35.7143f,95.2381f, 26.1905f,85.7143f, 21.4286f,76.1905f,
+	16.6667f,61.9048f, 16.6667f,38.0952f, 21.4286f,23.8095f, 26.1905f,14.2857f, 35.7143f,4.7619f, 45.2381f,0, 64.2857f,0, 73.8096f,4.7619f,
+	83.3334f,14.2857f, 88.0952f,23.8095f, 88.0952f,38.0952f,
+	64.2857f,38.0952f, 88.0952f,38.0952f,
+	// 72 H
+	19.0476f,100, 19.0476f,0,
+	85.7143f,100, 85.7143f,0,
+	19.0476f,52.381f, 85.7143f,52.381f,
+	// 73 I
+	52.381f,100, 52.381f,0,
+	// 74 J
+	76.1905f,100, 76.1905f,23.8095f, 71.4286f,9.5238f, 66.6667f,4.7619f, 57.1429f,0, 47.6191f,0, 38.0953f,4.7619f, 33.3334f,9.5238f,
+	28.5715f,23.8095f, 28.5715f,33.3333f,
+	// 75 K
+	19.0476f,100, 19.0476f,0,
+	85.7143f,100, 19.0476f,33.3333f,
+	42.8571f,57.1429f, 85.7143f,0,
+	// 76 L
+	23.8095f,100, 23.8095f,0,
+	23.8095f,0, 80.9524f,0,
+	// 77 M
+	14.2857f,100, 14.2857f,0,
+	14.2857f,100, 52.3809f,0,
+	90.4762f,100, 52.3809f,0,
+	90.4762f,100, 90.4762f,0,
+	// 78 N
+	19.0476f,100, 19.0476f,0,
+	19.0476f,100, 85.7143f,0,
+	85.7143f,100, 85.7143f,0,
+	// 79 O
+	42.8571f,100, 33.3333f,95.2381f, 23.8095f,85.7143f, 19.0476f,76.1905f, 14.2857f,61.9048f, 14.2857f,38.0952f, 19.0476f,23.8095f, 23.8095f,14.2857f,
+	33.3333f,4.7619f, 42.8571f,0, 61.9047f,0, 71.4286f,4.7619f, 80.9524f,14.2857f, 85.7143f,23.8095f, 90.4762f,38.0952f, 90.4762f,61.9048f,
+	85.7143f,76.1905f, 80.9524f,85.7143f, 71.4286f,95.2381f, 61.9047f,100, 42.8571f,100,
+	// 80 P
+	19.0476f,100, 19.0476f,0,
+	19.0476f,100, 61.9047f,100, 76.1905f,95.2381f, 80.9524f,90.4762f, 85.7143f,80.9524f, 85.7143f,66.6667f, 80.9524f,57.1429f, 76.1905f,52.381f,
+	61.9047f,47.619f, 19.0476f,47.619f,
+	// 81 Q
+	42.8571f,100, 33.3333f,95.2381f, 23.8095f,85.7143f, 19.0476f,76.1905f, 14.2857f,61.9048f, 14.2857f,38.0952f, 19.0476f,23.8095f, 23.8095f,14.2857f,
+	33.3333f,4.7619f, 42.8571f,0, 61.9047f,0, 71.4286f,4.7619f, 80.9524f,14.2857f, 85.7143f,23.8095f, 90.4762f,38.0952f, 90.4762f,61.9048f,
+	85.7143f,76.1905f, 80.9524f,85.7143f, 71.4286f,95.2381f, 61.9047f,100, 42.8571f,100,
+	57.1428f,19.0476f, 85.7143f,-9.5238f,
+	// 82 R
+	19.0476f,100, 19.0476f,0,
+	19.0476f,100, 61.9047f,100, 76.1905f,95.2381f, 80.9524f,90.4762f, 85.7143f,80.9524f, 85.7143f,71.4286f, 80.9524f,61.9048f, 76.1905f,57.1429f,
+	61.9047f,52.381f, 19.0476f,52.381f,
+	52.3809f,52.381f, 85.7143f,0,
+	// 83 S
+	85.7143f,85.7143f, 76.1905f,95.2381f, 61.9047f,100, 42.8571f,100, 28.5714f,95.2381f, 19.0476f,85.7143f, 19.0476f,76.1905f, 23.8095f,66.6667f,
+	28.5714f,61.9048f, 38.0952f,57.1429f, 66.6666f,47.619f, 76.1905f,42.8571f, 80.9524f,38.0952f, 85.7143f,28.5714f, 85.7143f,14.2857f, 76.1905f,4.7619f,
+	61.9047f,0, 42.8571f,0, 28.5714f,4.7619f, 19.0476f,14.2857f,
+	// 84 T
+	52.3809f,100, 52.3809f,0,
+	19.0476f,100, 85.7143f,100,
+	// 85 U
+	19.0476f,100, 19.0476f,28.5714f, 23.8095f,14.2857f, 33.3333f,4.7619f, 47.619f,0, 57.1428f,0, 71.4286f,4.7619f, 80.9524f,14.2857f,
+	85.7143f,28.5714f, 85.7143f,100,
+	// 86 V
+	14.2857f,100, 52.3809f,0,
+	90.4762f,100, 52.3809f,0,
+	// 87 W
+	4.7619f,100, 28.5714f,0,
+	52.3809f,100, 28.5714f,0,
+	52.3809f,100, 76.1905f,0,
+	100,100, 76.1905f,0,
+	// 88 X
+	19.0476f,100, 85.7143f,0,
+	85.7143f,100, 19.0476f,0,
+	// 89 Y
+	14.2857f,100, 52.3809f,52.381f, 52.3809f,0,
+	90.4762f,100, 52.3809f,52.381f,
+	// 90 Z
+	85.7143f,100, 19.0476f,0,
+	19.0476f,100, 85.7143f,100,
+	19.0476f,0, 85.7143f,0,
+	// 91 [
+	35.7143f,119.048f, 35.7143f,-33.3333f,
+	40.4762f,119.048f, 40.4762f,-33.3333f,
+	35.7143f,119.048f, 69.0476f,119.048f,
+	35.7143f,-33.3333f, 69.0476f,-33.3333f,
+	// 92
+	19.0476f,100, 85.7143f,-14.2857f,
+	// 93 ]
+	64.2857f,119.048f, 64.2857f,-33.3333f,
+	69.0476f,119.048f, 69.0476f,-33.3333f,
+	35.7143f,119.048f, 69.0476f,119.048f,
+	35.7143f,-33.3333f, 69.0476f,-33.3333f,
+	// 94 ^
+	52.3809f,109.524f, 14.2857f,42.8571f,
+	52.3809f,109.524f, 90.4762f,42.8571f,
+	// 95 _
+	0,-33.3333f, 104.762f,-33.3333f, 104.762f,-28.5714f, 0,-28.5714f, 0,-33.3333f,
+	// 96 `
+	42.8572f,100, 66.6667f,71.4286f,
+	42.8572f,100, 38.0953f,95.2381f, 66.6667f,71.4286f,
+	// 97 a
+	80.9524f,66.6667f, 80.9524f,0,
+	80.9524f,52.381f, 71.4285f,61.9048f, 61.9047f,66.6667f, 47.619f,66.6667f, 38.0952f,61.9048f, 28.5714f,52.381f, 23.8095f,38.0952f, 23.8095f,28.5714f,
+	28.5714f,14.2857f, 38.0952f,4.7619f, 47.619f,0, 61.9047f,0, 71.4285f,4.7619f, 80.9524f,14.2857f,
+	// 98 b
+	23.8095f,100, 23.8095f,0,
+	23.8095f,52.381f, 33.3333f,61.9048f, 42.8571f,66.6667f, 57.1428f,66.6667f, 66.6666f,61.9048f, 76.1905f,52.381f, 80.9524f,38.0952f, 80.9524f,28.5714f,
+	76.1905f,14.2857f, 66.6666f,4.7619f, 57.1428f,0, 42.8571f,0, 33.3333f,4.7619f, 23.8095f,14.2857f,
+	// 99 c
+	80.9524f,52.381f, 71.4285f,61.9048f, 61.9047f,66.6667f, 47.619f,66.6667f, 38.0952f,61.9048f, 28.5714f,52.381f, 23.8095f,38.0952f, 23.8095f,28.5714f,
+	28.5714f,14.2857f, 38.0952f,4.7619f, 47.619f,0, 61.9047f,0, 71.4285f,4.7619f, 80.9524f,14.2857f,
+	// 100 d
+	80.9524f,100, 80.9524f,0,
+	80.9524f,52.381f, 71.4285f,61.9048f, 61.9047f,66.6667f, 47.619f,66.6667f, 38.0952f,61.9048f, 28.5714f,52.381f, 23.8095f,38.0952f, 23.8095f,28.5714f,
+	28.5714f,14.2857f, 38.0952f,4.7619f, 47.619f,0, 61.9047f,0, 71.4285f,4.7619f, 80.9524f,14.2857f,
+	// 101 e
+	23.8095f,38.0952f, 80.9524f,38.0952f, 80.9524f,47.619f, 76.1905f,57.1429f, 71.4285f,61.9048f, 61.9047f,66.6667f, 47.619f,66.6667f, 38.0952f,61.9048f,
+	28.5714f,52.381f, 23.8095f,38.0952f, 23.8095f,28.5714f, 28.5714f,14.2857f, 38.0952f,4.7619f, 47.619f,0, 61.9047f,0, 71.4285f,4.7619f,
+	80.9524f,14.2857f,
+	// 102 f
+	71.4286f,100, 61.9048f,100, 52.381f,95.2381f, 47.6191f,80.9524f, 47.6191f,0,
+	33.3334f,66.6667f, 66.6667f,66.6667f,
+	// 103 g
+	80.9524f,66.6667f, 80.9524f,-9.5238f, 76.1905f,-23.8095f, 71.4285f,-28.5714f, 61.9047f,-33.3333f, 47.619f,-33.3333f, 38.0952f,-28.5714f,
+	80.9524f,52.381f, 71.4285f,61.9048f, 61.9047f,66.6667f, 47.619f,66.6667f, 38.0952f,61.9048f, 28.5714f,52.381f, 23.8095f,38.0952f, 23.8095f,28.5714f,
+	28.5714f,14.2857f, 38.0952f,4.7619f, 47.619f,0, 61.9047f,0, 71.4285f,4.7619f, 80.9524f,14.2857f,
+	// 104 h
+	26.1905f,100, 26.1905f,0,
+	26.1905f,47.619f, 40.4762f,61.9048f, 50,66.6667f, 64.2857f,66.6667f, 73.8095f,61.9048f, 78.5715f,47.619f, 78.5715f,0,
+	// 105 i
+	47.6191f,100, 52.381f,95.2381f, 57.1429f,100, 52.381f,104.762f, 47.6191f,100,
+	52.381f,66.6667f, 52.381f,0,
+	// 106 j
+	57.1429f,100, 61.9048f,95.2381f, 66.6667f,100, 61.9048f,104.762f, 57.1429f,100,
+	61.9048f,66.6667f, 61.9048f,-14.2857f, 57.1429f,-28.5714f, 47.6191f,-33.3333f, 38.0953f,-33.3333f,
+	// 107 k
+	26.1905f,100, 26.1905f,0,
+	73.8095f,66.6667f, 26.1905f,19.0476f,
+	45.2381f,38.0952f, 78.5715f,0,
+	// 108 l
+	52.381f,100, 52.381f,0,
+	// 109 m
+	0,66.6667f, 0,0,
+	0,47.619f, 14.2857f,61.9048f, 23.8095f,66.6667f, 38.0952f,66.6667f, 47.619f,61.9048f, 52.381f,47.619f, 52.381f,0,
+	52.381f,47.619f, 66.6667f,61.9048f, 76.1905f,66.6667f, 90.4762f,66.6667f, 100,61.9048f, 104.762f,47.619f, 104.762f,0,
+	// 110 n
+	26.1905f,66.6667f, 26.1905f,0,
+	26.1905f,47.619f, 40.4762f,61.9048f, 50,66.6667f, 64.2857f,66.6667f, 73.8095f,61.9048f, 78.5715f,47.619f, 78.5715f,0,
+	// 111 o
+	45.2381f,66.6667f, 35.7143f,61.9048f, 26.1905f,52.381f, 21.4286f,38.0952f, 21.4286f,28.5714f, 26.1905f,14.2857f, 35.7143f,4.7619f, 45.2381f,0,
+	59.5238f,0, 69.0476f,4.7619f, 78.5714f,14.2857f, 83.3334f,28.5714f, 83.3334f,38.0952f, 78.5714f,52.381f, 69.0476f,61.9048f, 59.5238f,66.6667f,
+	45.2381f,66.6667f,
+	// 112 p
+	23.8095f,66.6667f, 23.8095f,-33.3333f,
+	23.8095f,52.381f, 33.3333f,61.9048f, 42.8571f,66.6667f, 57.1428f,66.6667f, 66.6666f,61.9048f, 76.1905f,52.381f, 80.9524f,38.0952f, 80.9524f,28.5714f,
+	76.1905f,14.2857f, 66.6666f,4.7619f, 57.1428f,0, 42.8571f,0, 33.3333f,4.7619f, 23.8095f,14.2857f,
+	// 113 q
+	80.9524f,66.6667f, 80.9524f,-33.3333f,
+	80.9524f,52.381f, 71.4285f,61.9048f, 61.9047f,66.6667f, 47.619f,66.6667f, 38.0952f,61.9048f, 28.5714f,52.381f, 23.8095f,38.0952f, 23.8095f,28.5714f,
+	28.5714f,14.2857f, 38.0952f,4.7619f, 47.619f,0, 61.9047f,0, 71.4285f,4.7619f, 80.9524f,14.2857f,
+	// 114 r
+	33.3334f,66.6667f, 33.3334f,0,
+	33.3334f,38.0952f, 38.0953f,52.381f, 47.6191f,61.9048f, 57.1429f,66.6667f, 71.4286f,66.6667f,
+	// 115 s
+	78.5715f,52.381f, 73.8095f,61.9048f, 59.5238f,66.6667f, 45.2381f,66.6667f, 30.9524f,61.9048f, 26.1905f,52.381f, 30.9524f,42.8571f, 40.4762f,38.0952f,
+	64.2857f,33.3333f, 73.8095f,28.5714f, 78.5715f,19.0476f, 78.5715f,14.2857f, 73.8095f,4.7619f, 59.5238f,0, 45.2381f,0, 30.9524f,4.7619f,
+	26.1905f,14.2857f,
+	// 116 t
+	47.6191f,100, 47.6191f,19.0476f, 52.381f,4.7619f, 61.9048f,0, 71.4286f,0,
+	33.3334f,66.6667f, 66.6667f,66.6667f,
+	// 117 u
+	26.1905f,66.6667f, 26.1905f,19.0476f, 30.9524f,4.7619f, 40.4762f,0, 54.7619f,0, 64.2857f,4.7619f, 78.5715f,19.0476f,
+	78.5715f,66.6667f, 78.5715f,0,
+	// 118 v
+	23.8095f,66.6667f, 52.3809f,0,
+	80.9524f,66.6667f, 52.3809f,0,
+	// 119 w
+	14.2857f,66.6667f, 33.3333f,0,
+	52.3809f,66.6667f, 33.3333f,0,
+	52.3809f,66.6667f, 71.4286f,0,
+	90.4762f,66.6667f, 71.4286f,0,
+	// 120 x
+	26.1905f,66.6667f, 78.5715f,0,
+	78.5715f,66.6667f, 26.1905f,0,
+	// 121 y
+	26.1905f,66.6667f, 54.7619f,0,
+	83.3334f,66.6667f, 54.7619f,0, 45.2381f,-19.0476f, 35.7143f,-28.5714f, 26.1905f,-33.3333f, 21.4286f,-33.3333f,
+	// 122 z
+	78.5715f,66.6667f, 26.1905f,0,
+	26.1905f,66.6667f, 78.5715f,66.6667f,
+	26.1905f,0, 78.5715f,0,
+	// 123 {
+	64.2857f,119.048f, 54.7619f,114.286f, 50,109.524f, 45.2381f,100, 45.2381f,90.4762f, 50,80.9524f, 54.7619f,76.1905f, 59.5238f,66.6667f,
+	59.5238f,57.1429f, 50,47.619f,
+	54.7619f,114.286f, 50,104.762f, 50,95.2381f, 54.7619f,85.7143f, 59.5238f,80.9524f, 64.2857f,71.4286f, 64.2857f,61.9048f, 59.5238f,52.381f,
+	40.4762f,42.8571f, 59.5238f,33.3333f, 64.2857f,23.8095f, 64.2857f,14.2857f, 59.5238f,4.7619f, 54.7619f,0, 50,-9.5238f, 50,-19.0476f,
+	54.7619f,-28.5714f,
+	50,38.0952f, 59.5238f,28.5714f, 59.5238f,19.0476f, 54.7619f,9.5238f, 50,4.7619f, 45.2381f,-4.7619f, 45.2381f,-14.2857f, 50,-23.8095f,
+	54.7619f,-28.5714f, 64.2857f,-33.3333f,
+	// 124 |
+	52.381f,119.048f, 52.381f,-33.3333f,
+	// 125 }
+	40.4762f,119.048f, 50,114.286f, 54.7619f,109.524f, 59.5238f,100, 59.5238f,90.4762f, 54.7619f,80.9524f, 50,76.1905f, 45.2381f,66.6667f,
+	45.2381f,57.1429f, 54.7619f,47.619f,
+	50,114.286f, 54.7619f,104.762f, 54.7619f,95.2381f, 50,85.7143f, 45.2381f,80.9524f, 40.4762f,71.4286f, 40.4762f,61.9048f, 45.2381f,52.381f,
+	64.2857f,42.8571f, 45.2381f,33.3333f, 40.4762f,23.8095f, 40.4762f,14.2857f, 45.2381f,4.7619f, 50,0, 54.7619f,-9.5238f, 54.7619f,-19.0476f,
+	50,-28.5714f,
+	54.7619f,38.0952f, 45.2381f,28.5714f, 45.2381f,19.0476f, 50,9.5238f, 54.7619f,4.7619f, 59.5238f,-4.7619f, 59.5238f,-14.2857f, 54.7619f,-23.8095f,
+	50,-28.5714f, 40.4762f,-33.3333f,
+	// 126 ~
+	9.5238f,28.5714f, 9.5238f,38.0952f, 14.2857f,52.381f, 23.8095f,57.1429f, 33.3333f,57.1429f, 42.8571f,52.381f, 61.9048f,38.0952f, 71.4286f,33.3333f,
+	80.9524f,33.3333f, 90.4762f,38.0952f, 95.2381f,47.619f,
+	9.5238f,38.0952f, 14.2857f,47.619f, 23.8095f,52.381f, 33.3333f,52.381f, 42.8571f,47.619f, 61.9048f,33.3333f, 71.4286f,28.5714f, 80.9524f,28.5714f,
+	90.4762f,33.3333f, 95.2381f,47.619f, 95.2381f,57.1429f,
+	// 127
+	71.4286f,100, 33.3333f,-33.3333f,
+	47.619f,66.6667f, 33.3333f,61.9048f, 23.8095f,52.381f, 19.0476f,38.0952f, 19.0476f,23.8095f, 23.8095f,14.2857f, 33.3333f,4.7619f, 47.619f,0,
+	57.1428f,0, 71.4286f,4.7619f, 80.9524f,14.2857f, 85.7143f,28.5714f, 85.7143f,42.8571f, 80.9524f,52.381f, 71.4286f,61.9048f, 57.1428f,66.6667f,
+	47.619f,66.6667f,
+};
+
+static const unsigned char MonoRomanStrips[] =
+{
+	2, 5,   // 33
+	2, 2,   // 34
+	2, 2, 2, 2,   // 35
+	2, 2, 20,   // 36
+	2, 16, 11,   // 37
+	34,   // 38
+	2,   // 39
+	10,   // 40
+	10,   // 41
+	2, 2, 2,   // 42
+	2, 2,   // 43
+	8,   // 44
+	2,   // 45
+	5,   // 46
+	2,   // 47
+	17,   // 48
+	4,   // 49
+	14,   // 50
+	15,   // 51
+	3, 2,   // 52
+	17,   // 53
+	23,   // 54
+	2, 2,   // 55
+	29,   // 56
+	23,   // 57
+	5, 5,   // 58
+	5, 8,   // 59
+	3,   // 60
+	2, 2,   // 61
+	3,   // 62
+	14, 5,   // 63
+	8, 19,   // 64
+	2, 2, 2,   // 65
+	2, 9, 10,   // 66
+	18,   // 67
+	2, 12,   // 68
+	2, 2, 2, 2,   // 69
+	2, 2, 2,   // 70
+	19, 2,   // 71
+	2, 2, 2,   // 72
+	2,   // 73
+	10,   // 74
+	2, 2, 2,   // 75
+	2, 2,   // 76
+	2, 2, 2, 2,   // 77
+	2, 2, 2,   // 78
+	21,   // 79
+	2, 10,   // 80
+	21, 2,   // 81
+	2, 10, 2,   // 82
+	20,   // 83
+	2, 2,   // 84
+	10,   // 85
+	2, 2,   // 86
+	2, 2, 2, 2,   // 87
+	2, 2,   // 88
+	3, 2,   // 89
+	2, 2, 2,   // 90
+	2, 2, 2, 2,   // 91
+	2,   // 92
+	2, 2, 2, 2,   // 93
+	2, 2,   // 94
+	5,   // 95
+	2, 3,   // 96
+	2, 14,   // 97
+	2, 14,   // 98
+	14,   // 99
+	2, 14,   // 100
+	17,   // 101
+	5, 2,   // 102
+	7, 14,   // 103
+	2, 7,   // 104
+	5, 2,   // 105
+	5, 5,   // 106
+	2, 2, 2,   // 107
+	2,   // 108
+	2, 7, 7,   // 109
+	2, 7,   // 110
+	17,   // 111
+	2, 14,   // 112
+	2, 14,   // 113
+	2, 5,   // 114
+	17,   // 115
+	5, 2,   // 116
+	7, 2,   // 117
+	2, 2,   // 118
+	2, 2, 2, 2,   // 119
+	2, 2,   // 120
+	2, 6,   // 121
+	2, 2, 2,   // 122
+	10, 17, 10,   // 123
+	2,   // 124
+	10, 17, 10,   // 125
+	11, 11,   // 126
+	2, 17,   // 127
+};
+
+static const StrokeGlyph MonoRomanGlyphs[96] =
+{
+	{ 104.762f, 0 }, { 104.762f, 2 }, { 104.762f, 2 }, { 104.762f, 4 },
+	{ 104.762f, 3 }, { 104.762f, 3 }, { 104.762f, 1 }, { 104.762f, 1 },
+	{ 104.762f, 1 }, { 104.762f, 1 }, { 104.762f, 3 }, { 104.762f, 2 },
+	{ 104.762f, 1 }, { 104.762f, 1 }, { 104.762f, 1 }, { 104.762f, 1 },
+	{ 104.762f, 1 }, { 104.762f, 1 }, { 104.762f, 1 }, { 104.762f, 1 },
+	{ 104.762f, 2 }, { 104.762f, 1 }, { 104.762f, 1 }, { 104.762f, 2 },
+	{ 104.762f, 1 }, { 104.762f, 1 }, { 104.762f, 2 }, { 104.762f, 2 },
+	{ 104.762f, 1 }, { 104.762f, 2 }, { 104.762f, 1 }, { 104.762f, 2 },
+	{ 104.762f, 2 }, { 104.762f, 3 }, { 104.762f, 3 }, { 104.762f, 1 },
+	{ 104.762f, 2 }, { 104.762f, 4 }, { 104.762f, 3 }, { 104.762f, 2 },
+	{ 104.762f, 3 }, { 104.762f, 1 }, { 104.762f, 1 }, { 104.762f, 3 },
+	{ 104.762f, 2 }, { 104.762f, 4 }, { 104.762f, 3 }, { 104.762f, 1 },
+	{ 104.762f, 2 }, { 104.762f, 2 }, { 104.762f, 3 }, { 104.762f, 1 },
+	{ 104.762f, 2 }, { 104.762f, 1 }, { 104.762f, 2 }, { 104.762f, 4 },
+	{ 104.762f, 2 }, { 104.762f, 2 }, { 104.762f, 3 }, { 104.762f, 4 },
+	{ 104.762f, 1 }, { 104.762f, 4 }, { 104.762f, 2 }, { 104.762f, 1 },
+	{ 104.762f, 2 }, { 104.762f, 2 }, { 104.762f, 2 }, { 104.762f, 1 },
+	{ 104.762f, 2 }, { 104.762f, 1 }, { 104.762f, 2 }, { 104.762f, 2 },
+	{ 104.762f, 2 }, { 104.762f, 2 }, { 104.762f, 2 }, { 104.762f, 3 },
+	{ 104.762f, 1 }, { 104.762f, 3 }, { 104.762f, 2 }, { 104.762f, 1 },
+	{ 104.762f, 2 }, { 104.762f, 2 }, { 104.762f, 2 }, { 104.762f, 1 },
+	{ 104.762f, 2 }, { 104.762f, 2 }, { 104.762f, 2 }, { 104.762f, 4 },
+	{ 104.762f, 2 }, { 104.762f, 2 }, { 104.762f, 3 }, { 104.762f, 3 },
+	{ 104.762f, 1 }, { 104.762f, 3 }, { 104.762f, 2 }, { 104.762f, 2 },
+};
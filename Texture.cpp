@@ -4,8 +4,15 @@
 #include <string>
 #include "GlutImport.h"
 #include <map>
+#include <list>
 #include <vector>
+#include <chrono>
 #include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <cctype>
+#include <sys/types.h>
+#include <sys/stat.h>
 #include "jpeg_decoder.h"
 
 /////////////////////////////////////////////////////////////
@@ -60,16 +67,13 @@ void VsymetryRGBAImage(std::vector<unsigned char>& data, int Width, int Height,
 	}
 }
 
-int LoadPNGintoTexture(const std::string& filename)
+static int LoadPNG(const std::string& filename, size_t& bytes)
 {
 	std::vector<unsigned char> buffer, image;
 	loadFile(buffer, filename);
 	unsigned long w, h;
 	int error = decodePNG(image, w, h, buffer.empty() ? 0 : &buffer[0], (unsigned long)buffer.size());
 
-	int bytePerPix = (image.size() / (w * h) );
-	VsymetryRGBAImage(image, w, h, bytePerPix);
-
 	//if there's an error, display it
 	if (error != 0)
 	{
@@ -77,26 +81,20 @@ int LoadPNGintoTexture(const std::string& filename)
 		return IDerror;
 	}
 
+	int bytePerPix = (image.size() / (w * h) );
+	VsymetryRGBAImage(image, w, h, bytePerPix);
+
 	//the pixels are now in the vector "image", use it as texture, draw it, ...
 
 	int id = CreateTextureFromRGBA(image.data(), w, h);
+	bytes = (size_t)w * h * 4;
 	return id;
 }
 
-
-
-
-std::map<std::string, int> glTextKey;
-
-int GetTextureIdFromPNG(std::string PNGFileName)
+int LoadPNGintoTexture(const std::string& filename)
 {
-	// si jamais charg, on charge le fichier image dans une texture opengl
-
-	if (glTextKey.find(PNGFileName) == glTextKey.end()) // texture jamais charge
-		glTextKey[PNGFileName] = LoadPNGintoTexture(PNGFileName);
-
-	// on retourn id de la texture associe  ce fichier
-	return glTextKey[PNGFileName];
+	size_t bytes;
+	return LoadPNG(filename, bytes);
 }
 
 /////////////////////////////////////////////////////////////
@@ -105,30 +103,16 @@ int GetTextureIdFromPNG(std::string PNGFileName)
 //
 /////////////////////////////////////////////////////////////
 
-int GetTextureIdFromJPG(std::string JPGFileName)
+static int LoadJPG(const std::string& JPGFileName, size_t& bytes)
 {
-	size_t size;
-	unsigned char* buf;
-	FILE* f;
-
-
-	f = fopen(JPGFileName.c_str(), "rb");
+	std::ifstream f(JPGFileName, std::ios::binary | std::ios::ate);
 	if (!f) { std::cout << "Error opening the input file.\n";  return IDerror; }
-	 
-	fseek(f, 0, SEEK_END);
-	size = ftell(f);
-	buf = (unsigned char*)malloc(size);
-	if ( buf == NULL)
-	{
-		std::cout << "Memory error loading JPG\n";
-		return IDerror;
-	}
-	fseek(f, 0, SEEK_SET);
-	size_t read = fread(buf, 1, size, f);
-	fclose(f);
 
-	Jpeg::Decoder decoder(buf, size);
-	int tt = decoder.GetResult();
+	std::vector<unsigned char> buf((size_t)f.tellg());
+	f.seekg(0);
+	f.read((char*)buf.data(), buf.size());
+
+	Jpeg::Decoder decoder(buf.data(), buf.size());
 
 	if (decoder.GetResult() != Jpeg::Decoder::OK)
 	{
@@ -144,12 +128,159 @@ int GetTextureIdFromJPG(std::string JPGFileName)
 		std::cout << "Error - not an RGB image\n";
 		return IDerror;
 	}
-	 
 
-	unsigned char* buff = decoder.GetImage();
-	size_t  len         = decoder.GetImageSize();
+	int id = CreateTextureFromRGB(decoder.GetImage(), decoder.GetWidth(), decoder.GetHeight());
+	bytes = (size_t)decoder.GetWidth() * decoder.GetHeight() * 3;
+	return id;
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Image in memory, without OpenGL (see SoftGraphics)
+//
+/////////////////////////////////////////////////////////////
 
+// RGBA pixels, first row = top of the image
+bool LoadImageRGBA(const std::string& filename, std::vector<unsigned char>& rgba, int& w, int& h)
+{
+	std::vector<unsigned char> buffer;
+	loadFile(buffer, filename);
+	if (buffer.empty()) { std::cout << "Error opening " << filename << std::endl; return false; }
 
-	int id = CreateTextureFromRGB(buff, decoder.GetWidth(), decoder.GetHeight());
-	return id;
+	if (buffer.size() > 4 && buffer[1] == 'P' && buffer[2] == 'N' && buffer[3] == 'G')
+	{
+		unsigned long pw, ph;
+		if (decodePNG(rgba, pw, ph, &buffer[0], buffer.size()) != 0) return false;
+		w = (int)pw;
+		h = (int)ph;
+		return true;
+	}
+
+	Jpeg::Decoder decoder(buffer.data(), buffer.size());
+	if (decoder.GetResult() != Jpeg::Decoder::OK || !decoder.IsColor()) return false;
+
+	w = decoder.GetWidth();
+	h = decoder.GetHeight();
+	const unsigned char* rgb = decoder.GetImage();
+	rgba.resize((size_t)w * h * 4);
+	for (size_t i = 0; i < (size_t)w * h; ++i)
+	{
+		rgba[4 * i + 0] = rgb[3 * i + 0];
+		rgba[4 * i + 1] = rgb[3 * i + 1];
+		rgba[4 * i + 2] = rgb[3 * i + 2];
+		rgba[4 * i + 3] = 255;
+	}
+	return true;
+}
+
+/////////////////////////////////////////////////////////////
+//
+//	    Texture cache
+//
+/////////////////////////////////////////////////////////////
+
+// PNG and JPG files share one cache keyed by path : a file is decoded once,
+// and decoded again only if its modification time changes.
+// When the textures exceed the GPU memory budget, the least recently used are deleted.
+
+struct CachedTexture
+{
+	int    id;
+	size_t bytes;      // GPU memory, 0 when the error texture is used
+	time_t mtime;
+	std::chrono::steady_clock::time_point lastCheck;
+	std::list<std::string>::iterator lru;
+};
+
+static std::map<std::string, CachedTexture> gTextures;
+static std::list<std::string> gLRU;                      // most recently used first
+static size_t gTextureBytes  = 0;
+static size_t gTextureBudget = 256 * 1024 * 1024;
+static const std::chrono::seconds MTimeCheckPeriod(1);   // avoid a stat() per draw
+
+static time_t FileMTime(const std::string& filename)
+{
+	struct stat st;
+	return (stat(filename.c_str(), &st) == 0) ? st.st_mtime : 0;
+}
+
+static std::string GetExtSafe(const std::string& f)
+{
+	std::string s = f;
+	std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+	if (s.size() >= 5 && s.rfind(".jpeg") == s.size() - 5) return ".jpeg";
+	if (s.size() >= 4) return s.substr(s.size() - 4); // .jpg / .png
+	return "";
+}
+
+static int LoadTexture(const std::string& filename, size_t& bytes)
+{
+	bytes = 0;
+	auto ext = GetExtSafe(filename);
+	if (ext == ".jpg" || ext == ".jpeg") return LoadJPG(filename, bytes);
+	if (ext == ".png")                   return LoadPNG(filename, bytes);
+
+	std::cout << "Unknown image format : " << filename << std::endl;
+	return IDerror;
+}
+
+static void ReleaseTexture(CachedTexture& T)
+{
+	if (T.id > 0 && T.id != IDerror)
+	{
+		GLuint t = (GLuint)T.id;
+		glDeleteTextures(1, &t);
+	}
+	gTextureBytes -= T.bytes;
+}
+
+static void EvictTextures(const std::string& keep)
+{
+	while (gTextureBytes > gTextureBudget && !gLRU.empty() && gLRU.back() != keep)
+	{
+		auto it = gTextures.find(gLRU.back());
+		std::cout << "Texture evicted : " << it->first << std::endl;
+		ReleaseTexture(it->second);
+		gTextures.erase(it);
+		gLRU.pop_back();
+	}
+}
+
+void SetTextureMemoryBudget(size_t bytes)
+{
+	gTextureBudget = bytes;
+	EvictTextures("");
+}
+
+int GetTextureId(const std::string& filename)
+{
+	auto now = std::chrono::steady_clock::now();
+
+	auto it = gTextures.find(filename);
+	if (it != gTextures.end())
+	{
+		CachedTexture& T = it->second;
+		gLRU.splice(gLRU.begin(), gLRU, T.lru);
+
+		if (now - T.lastCheck < MTimeCheckPeriod) return T.id;
+		T.lastCheck = now;
+		if (FileMTime(filename) == T.mtime) return T.id;
+
+		// file modified on disk : decode it again
+		ReleaseTexture(T);
+		gLRU.erase(T.lru);
+		gTextures.erase(it);
+	}
+
+	CachedTexture T;
+	T.mtime     = FileMTime(filename);
+	T.lastCheck = now;
+	T.id        = LoadTexture(filename, T.bytes);
+	gLRU.push_front(filename);
+	T.lru = gLRU.begin();
+	gTextures[filename] = T;
+	gTextureBytes += T.bytes;
+
+	EvictTextures(filename);
+	return T.id;
 }
@@ -2,15 +2,21 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
 #include "Event.h"
 #include "Model.h"
 #include "ObjGeom.h"
+#include "Command.h"
 
 using namespace std;
 
 enum State { WAIT, INTERACT };
 
-void saveSceneSnapshot(Model& Data);
+// undo history, in eleve.cpp
+void executeCommand(Model& Data, unique_ptr<Command> cmd);
+void recordCommand(unique_ptr<Command> cmd);
 
 ////////////////////////////////////////////////////////////////////
 
@@ -23,7 +29,11 @@ public:
 	Tool() {   currentState = State::WAIT; }
 	virtual void processEvent(const Event& E, Model & Data) {}
 
+	// drawn every frame over the scene (preview, selection...)
 	virtual void draw(Graphics& G,const  Model& Data) {}
+
+	// drawn with the scene and kept in the frame cache : must only depend on the objects
+	virtual void drawLayer(Graphics& G, const Model& Data) {}
 };
 
 ////////////////////////////////////////////////////////////////////
@@ -52,11 +62,9 @@ public :
 		{
 			if (currentState == State::INTERACT)
 			{
-				saveSceneSnapshot(Data);
-
 				V2 P2 = Data.currentMousePos;
-				auto newObj = make_shared<ObjSegment>(Data.drawingOptions, Pstart, P2);
-				Data.LObjets.push_back(newObj);
+				auto newObj = makeObject<ObjSegment>(Data.drawingOptions, Pstart, P2);
+				executeCommand(Data, make_unique<CmdAddObject>(newObj));
 
 				currentState = State::WAIT;
 				return;
@@ -101,11 +109,9 @@ public:
 		{
 			if (currentState == State::INTERACT)
 			{
-				saveSceneSnapshot(Data);  
-
 				V2 P2 = Data.currentMousePos;
-				auto newObj = make_shared<ObjRectangle>(Data.drawingOptions, Pstart, P2);
-				Data.LObjets.push_back(newObj);
+				auto newObj = makeObject<ObjRectangle>(Data.drawingOptions, Pstart, P2);
+				executeCommand(Data, make_unique<CmdAddObject>(newObj));
 
 				currentState = State::WAIT;
 				return;
@@ -154,11 +160,9 @@ public:
 		{
 			if (currentState == State::INTERACT)
 			{
-				saveSceneSnapshot(Data);  
-
 				V2 P2 = Data.currentMousePos;
-				auto newObj = make_shared<ObjCircle>(Data.drawingOptions, Pstart, P2);
-				Data.LObjets.push_back(newObj);
+				auto newObj = makeObject<ObjCircle>(Data.drawingOptions, Pstart, P2);
+				executeCommand(Data, make_unique<CmdAddObject>(newObj));
 
 				currentState = State::WAIT;
 				return;
@@ -227,10 +231,8 @@ public:
 	{
 		if (points_.size() >= 2)
 		{
-			saveSceneSnapshot(Data);  
-
-			auto newObj = make_shared<ObjPolyLine>(Data.drawingOptions, points_);
-			Data.LObjets.push_back(newObj);
+			auto newObj = makeObject<ObjPolyLine>(Data.drawingOptions, points_);
+			executeCommand(Data, make_unique<CmdAddObject>(newObj));
 		}
 		points_.clear();
 		currentState = WAIT;
@@ -257,6 +259,9 @@ public:
 class ToolEditPoints : public Tool
 {
 	V2* grabbedPoint_ = nullptr;
+	shared_ptr<ObjGeom> grabbedObj_;
+	size_t grabbedIndex_ = 0;
+	V2 grabbedStart_;      // position before the drag, for the undo history
 	bool dragging_ = false;
 
 public:
@@ -270,28 +275,26 @@ public:
 			grabbedPoint_ = nullptr;
 			dragging_ = false;
 
-			const float radius = 10.0f; 
+			const int radius = 10;
 
-			for (int i = (int)Data.LObjets.size() - 1; i >= 0; --i)
+			// only the points of the grid cells around the mouse are tested
+			grabbedObj_ = Data.pickControlPoint(mouse, radius, grabbedIndex_);
+			if (grabbedObj_)
 			{
-				auto& obj = Data.LObjets[i];
-				if (!obj) continue;
-
-				V2* candidate = obj->findClosestControlPoint(mouse, radius);
-				if (candidate)
-				{
-					saveSceneSnapshot(Data); 
-					grabbedPoint_ = candidate;
-					dragging_ = true;
-					break;
-				}
+				grabbedPoint_ = grabbedObj_->getControlPoint(grabbedIndex_);
+				grabbedStart_ = *grabbedPoint_;
+				dragging_ = true;
 			}
 			return;
 		}
 
 		if (E.Type == EventType::MouseUp && E.info == "0")
 		{
+			if (dragging_ && grabbedPoint_ && !(*grabbedPoint_ == grabbedStart_))
+				recordCommand(make_unique<CmdEditPoint>(grabbedObj_, grabbedIndex_, grabbedStart_, *grabbedPoint_));
+
 			grabbedPoint_ = nullptr;
+			grabbedObj_.reset();
 			dragging_ = false;
 			return;
 		}
@@ -300,18 +303,18 @@ public:
 		{
 			if (dragging_ && grabbedPoint_)
 			{
-				*grabbedPoint_ = Data.currentMousePos;
+				Data.moveControlPoint(grabbedObj_.get(), grabbedIndex_, Data.currentMousePos);
 			}
 		}
 	}
 
-	void draw(Graphics& G, const Model& Data) override
+	void drawLayer(Graphics& G, const Model& Data) override
 	{
+		// only the handles in the region being drawn
+		V2 P, size;
+		G.getClip(P, size);
 		std::vector<V2> pts;
-		for (auto& obj : Data.LObjets)
-		{
-			if (obj) obj->getControlPoints(pts);
-		}
+		Data.controlPointsIn(P - V2(6, 6), size + V2(12, 12), pts);
 
 		for (const auto& p : pts)
 		{
@@ -325,103 +328,129 @@ public:
 class ToolSelect : public Tool
 {
 protected:
-	std::shared_ptr<ObjGeom> selectedObj_;
+	std::vector< std::shared_ptr<ObjGeom> > selection_;   // in drawing order
+	V2 Pstart;             // corner of the rubber band
+
+	bool isSelected(const ObjGeom* obj) const
+	{
+		for (auto& o : selection_) if (o.get() == obj) return true;
+		return false;
+	}
+
+	// the same edit on each selected object, undone in one step
+	template <class Make>
+	void executeOnSelection(Model& Data, Make make)
+	{
+		auto group = make_unique<CmdGroup>();
+		for (auto& obj : selection_) group->add(make(obj));
+		if (!group->empty()) executeCommand(Data, move(group));
+	}
+
+	// rectangle from the press to the mouse
+	void band(const Model& Data, V2& P, V2& size) const { getPLH(Pstart, Data.currentMousePos, P, size); }
 
 public:
 
-	ToolSelect() : Tool(), selectedObj_(nullptr) {}
+	ToolSelect() : Tool() {}
 
-	std::shared_ptr<ObjGeom> getSelected() const { return selectedObj_; }
+	const std::vector< std::shared_ptr<ObjGeom> >& getSelection() const { return selection_; }
+	bool hasSelection() const { return !selection_.empty(); }
 
 	void deleteSelection(Model& Data)
 	{
-		if (!selectedObj_) return;
-
-		saveSceneSnapshot(Data);   
-
-		for (auto it = Data.LObjets.begin(); it != Data.LObjets.end(); ++it)
-		{
-			if (it->get() == selectedObj_.get())
-			{
-				Data.LObjets.erase(it);
-				selectedObj_.reset();
-				return;
-			}
-		}
+		executeOnSelection(Data, [](const shared_ptr<ObjGeom>& obj) { return make_unique<CmdDeleteObject>(obj); });
+		selection_.clear();
 	}
-	// move object to front (end of list = drawn last = on top)
+
+	// move objects to front (end of list = drawn last = on top), keeping their relative order
 	void bringToFront(Model& Data)
 	{
-		if (!selectedObj_) return;
-
-		saveSceneSnapshot(Data); 
-
-		for (auto it = Data.LObjets.begin(); it != Data.LObjets.end(); ++it)
-		{
-			if (it->get() == selectedObj_.get())
-			{
-				auto obj = *it;
-				Data.LObjets.erase(it);
-				Data.LObjets.push_back(obj);
-				return;
-			}
-		}
+		executeOnSelection(Data, [](const shared_ptr<ObjGeom>& obj) { return make_unique<CmdReorder>(obj, true); });
 	}
 
-
-	// move object to back (start of list = drawn first = behind)
+	// move objects to back (start of list = drawn first = behind)
+	// from the top one, so that the lowest one ends at the back
 	void sendToBack(Model& Data)
 	{
-		if (!selectedObj_) return;
-
-		saveSceneSnapshot(Data);
+		std::reverse(selection_.begin(), selection_.end());
+		executeOnSelection(Data, [](const shared_ptr<ObjGeom>& obj) { return make_unique<CmdReorder>(obj, false); });
+		std::reverse(selection_.begin(), selection_.end());
+	}
 
-		for (auto it = Data.LObjets.begin(); it != Data.LObjets.end(); ++it)
+	void changeAttributes(Model& Data, function<void(ObjAttr&)> change)
+	{
+		executeOnSelection(Data, [&](const shared_ptr<ObjGeom>& obj)
 		{
-			if (it->get() == selectedObj_.get())
-			{
-				auto obj = *it;
-				Data.LObjets.erase(it);
-				Data.LObjets.insert(Data.LObjets.begin(), obj);
-				return;
-			}
-		}
+			ObjAttr A = obj->drawInfo_;
+			change(A);
+			return make_unique<CmdChangeAttributes>(obj, A);
+		});
 	}
 
-
 	void processEvent(const Event& E, Model& Data) override
 	{
+		if (E.Type == EventType::MouseDown && E.info == "0")
+		{
+			Pstart = Data.currentMousePos;
+			currentState = State::INTERACT;
+			return;
+		}
+
 		// seleção no MouseUp (botão esquerdo)
-		if (E.Type == EventType::MouseUp && E.info == "0")
+		if (E.Type == EventType::MouseUp && E.info == "0" && currentState == State::INTERACT)
 		{
-			std::shared_ptr<ObjGeom> found = nullptr;
-			// procura do topo para baixo (up to down)
-			for (int i = (int)Data.LObjets.size() - 1; i >= 0; --i)
-			{
-				auto &obj = Data.LObjets[i];
-				if (!obj) continue;
+			currentState = State::WAIT;
+			V2 P, size;
+			band(Data, P, size);
 
-				// usa contains polimorfico
-				if (obj->contains(Data.currentMousePos)) { found = obj; break; }
+			// rubber band : from left to right the objects inside it, from right to left the objects it touches
+			if (size.x > 3 || size.y > 3)
+			{
+				selection_.clear();
+				Data.objectsInRegion(P, size, Data.currentMousePos.x >= Pstart.x, selection_);
+				return;
 			}
 
-			// toggle: se clicou no mesmo objeto -> desseleciona
-			if (found && selectedObj_ && found.get() == selectedObj_.get())
-				selectedObj_.reset();
+			// objeto desenhado sob o cursor, lido no buffer de IDs
+			std::shared_ptr<ObjGeom> found = Data.pickDrawn(Data.currentMousePos);
+
+			// toggle: se clicou num objeto selecionado -> desseleciona
+			if (found && isSelected(found.get()))
+				selection_.erase(std::remove(selection_.begin(), selection_.end(), found), selection_.end());
 			else
-				selectedObj_ = found;
+			{
+				selection_.clear();
+				if (found) selection_.push_back(found);
+			}
 		}
 	}
 
 	void draw(Graphics& G, const Model& Data) override
 	{
-		if (!selectedObj_) return;
+		if (currentState == State::INTERACT)
+		{
+			V2 P, size;
+			band(Data, P, size);
+			Color c = (Data.currentMousePos.x >= Pstart.x) ? Color::Cyan : Color::Green;
+			G.drawRectangle(P, size, c, false, 1);
+		}
+
+		// hover : thin frame around the object under the mouse
+		const ObjGeom* hover = Data.objectAt(Data.currentMousePos);
+		if (hover && !isSelected(hover))
+		{
+			V2 P, size;
+			hover->getStrokeBox(P, size);
+			G.drawRectangle(P - V2(2, 2), size + V2(4, 4), Color::Cyan, false, 1);
+		}
 
-		// usa getBoundingBox polimórfico
-		V2 P, size;
-		selectedObj_->getBoundingBox(P, size);
 		// desenha moldura magenta um pouco maior
-		G.drawRectangle(P - V2(4,4), size + V2(8,8), Color::Magenta, false, 4);
+		for (auto& obj : selection_)
+		{
+			V2 P, size;
+			obj->getBoundingBox(P, size);
+			G.drawRectangle(P - V2(4,4), size + V2(8,8), Color::Magenta, false, selection_.size() > 1 ? 2 : 4);
+		}
 	}
 };
 